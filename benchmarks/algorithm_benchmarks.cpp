@@ -0,0 +1,278 @@
+#include "graph_generators.h"
+#include "../graph/dynamic_shortest_paths.h"
+#include "../graph/all_pairs.h"
+#include "../graph/landmarks.h"
+#include "../graph/contraction_hierarchy.h"
+#include <benchmark/benchmark.h>
+
+// Бенчмарки алгоритмов поиска путей на разных формах графов.
+// Для каждой формы аргумент задаёт масштаб: число узлов (для решётки — сторону)
+
+static DirectedGraph makeShape(int shape, size_t scale)
+{
+    switch (shape)
+    {
+    case 0: return randomGraph(scale, scale * 8, 42);
+    case 1: return gridGraph(scale, scale, 42);
+    default: return powerLawGraph(scale, 4, 42);
+    }
+}
+
+static void setShapeLabel(benchmark::State& state, int shape)
+{
+    static const char* names[] = {"random", "grid", "power-law"};
+    state.SetLabel(names[shape]);
+}
+
+static void BM_Dijkstra(benchmark::State& state)
+{
+    int shape = state.range(0);
+    DirectedGraph graph = makeShape(shape, state.range(1));
+    setShapeLabel(state, shape);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.dijkstraPaths(0));
+    }
+}
+
+static void BM_DijkstraMap(benchmark::State& state)
+{
+    int shape = state.range(0);
+    DirectedGraph graph = makeShape(shape, state.range(1));
+    setShapeLabel(state, shape);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.dijkstra(0));
+    }
+}
+
+static void BM_ShortestPath(benchmark::State& state)
+{
+    int shape = state.range(0);
+    DirectedGraph graph = makeShape(shape, state.range(1));
+    size_t destination = graph.size() / 2;
+    setShapeLabel(state, shape);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.bidirectionalShortestPath(0, destination));
+    }
+}
+
+// A* с оценками 16 ориентиров между случайными парами узлов; счётчик settled — среднее число извлечённых узлов
+// (сравнивать с BM_AStarBlind — A* без эвристики, то есть алгоритмом Дейкстры с остановкой)
+static void BM_AStar(benchmark::State& state)
+{
+    int shape = state.range(0);
+    DirectedGraph graph = makeShape(shape, state.range(1));
+    LandmarkIndex index(graph, 16);
+    setShapeLabel(state, shape);
+
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<size_t> node(0, graph.size() - 1);
+    size_t settled = 0;
+    size_t total = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(index.shortestPath(graph, node(generator), node(generator), &settled));
+        total += settled;
+    }
+    state.counters["settled"] = benchmark::Counter(double(total), benchmark::Counter::kAvgIterations);
+}
+
+static void BM_AStarBlind(benchmark::State& state)
+{
+    int shape = state.range(0);
+    DirectedGraph graph = makeShape(shape, state.range(1));
+    setShapeLabel(state, shape);
+
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<size_t> node(0, graph.size() - 1);
+    auto zero = [](size_t) { return 0.0; };
+    size_t settled = 0;
+    size_t total = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.aStar(node(generator), node(generator), zero, &settled));
+        total += settled;
+    }
+    state.counters["settled"] = benchmark::Counter(double(total), benchmark::Counter::kAvgIterations);
+}
+
+static void BM_ContractionHierarchy(benchmark::State& state)
+{
+    int shape = state.range(0);
+    DirectedGraph graph = makeShape(shape, state.range(1));
+    ContractionHierarchy hierarchy(graph);
+    setShapeLabel(state, shape);
+
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<size_t> node(0, graph.size() - 1);
+    size_t settled = 0;
+    size_t total = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(hierarchy.shortestPath(node(generator), node(generator), &settled));
+        total += settled;
+    }
+    state.counters["settled"] = benchmark::Counter(double(total), benchmark::Counter::kAvgIterations);
+    state.counters["shortcuts"] = double(hierarchy.shortcutCount());
+}
+
+static void BM_DeltaStepping(benchmark::State& state)
+{
+    int shape = state.range(0);
+    DirectedGraph graph = makeShape(shape, state.range(1));
+    setShapeLabel(state, shape);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.deltaStepping(0, 25.0));
+    }
+}
+
+static void BM_BellmanFord(benchmark::State& state)
+{
+    DirectedGraph graph = negativeDagGraph(state.range(0), state.range(0) * 8, 42);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.bellmanFordPaths(0));
+    }
+}
+
+static void BM_Spfa(benchmark::State& state)
+{
+    DirectedGraph graph = negativeDagGraph(state.range(0), state.range(0) * 8, 42);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.spfa(0));
+    }
+}
+
+static void BM_Wave(benchmark::State& state)
+{
+    int shape = state.range(0);
+    DirectedGraph graph = makeShape(shape, state.range(1));
+    setShapeLabel(state, shape);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.waveAll(0));
+    }
+}
+
+// Волновой алгоритм до соседа исходного узла: стоимость запроса не должна зависеть от размера графа
+static void BM_WaveNearby(benchmark::State& state)
+{
+    int shape = state.range(0);
+    DirectedGraph graph = makeShape(shape, state.range(1));
+    setShapeLabel(state, shape);
+    size_t destination = 0;
+    graph.forEachVertex([&destination](size_t origin, double, size_t target)
+    {
+        if (origin == 0 && destination == 0) destination = target;
+    });
+    if (destination == 0)
+    {
+        state.SkipWithError("Origin has no outgoing vertexes");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.wave(0, destination));
+    }
+}
+
+// Изменение веса случайного ребра с поддержкой путей (сравнивать с BM_Dijkstra — полным пересчётом)
+static void BM_DynamicWeightUpdate(benchmark::State& state)
+{
+    int shape = state.range(0);
+    DirectedGraph graph = makeShape(shape, state.range(1));
+    setShapeLabel(state, shape);
+
+    std::vector<std::pair<size_t, size_t>> vertexes;
+    graph.forEachVertex([&vertexes](size_t origin, double, size_t destination) { vertexes.emplace_back(origin, destination); });
+    DynamicShortestPaths dynamic(graph, 0);
+
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<size_t> vertex(0, vertexes.size() - 1);
+    std::uniform_real_distribution<double> weight(1.0, 100.0);
+    for (auto _ : state)
+    {
+        auto [origin, destination] = vertexes[vertex(generator)];
+        dynamic.addVertex(origin, weight(generator), destination);
+    }
+}
+
+// Кратчайшие пути между всеми парами узлов: аргументы — число узлов и средняя степень
+// (сравнивать с BM_DijkstraEachNode — последовательным запуском Дейкстры из каждого узла)
+static void BM_FloydWarshall(benchmark::State& state)
+{
+    DirectedGraph graph = randomGraph(state.range(0), state.range(0) * state.range(1), 42);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(floydWarshall(graph));
+    }
+}
+
+static void BM_Johnson(benchmark::State& state)
+{
+    DirectedGraph graph = negativeDagGraph(state.range(0), state.range(0) * state.range(1), 42);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(johnson(graph));
+    }
+}
+
+static void BM_DijkstraEachNode(benchmark::State& state)
+{
+    DirectedGraph graph = randomGraph(state.range(0), state.range(0) * state.range(1), 42);
+
+    for (auto _ : state)
+    {
+        for (size_t origin = 0; origin < graph.size(); ++origin)
+        {
+            benchmark::DoNotOptimize(graph.dijkstraPaths(origin));
+        }
+    }
+}
+
+// Аргументы: форма графа (0 — случайный, 1 — решётка, 2 — степенной) и масштаб
+static void shapes(benchmark::internal::Benchmark* benchmark)
+{
+    for (int64_t scale : {1 << 10, 1 << 13, 1 << 16}) benchmark->Args({0, scale});
+    for (int64_t side : {32, 90, 256}) benchmark->Args({1, side});
+    for (int64_t scale : {1 << 10, 1 << 13, 1 << 16}) benchmark->Args({2, scale});
+}
+
+// Для иерархии сжатия случайные и степенные графы берутся меньше: у них нет иерархии, как у дорожной сети,
+// и предобработка оставляет большое несжатое ядро
+static void hierarchyShapes(benchmark::internal::Benchmark* benchmark)
+{
+    for (int64_t scale : {1 << 10, 1 << 13}) benchmark->Args({0, scale});
+    for (int64_t side : {32, 90, 256}) benchmark->Args({1, side});
+    for (int64_t scale : {1 << 10, 1 << 13}) benchmark->Args({2, scale});
+}
+
+BENCHMARK(BM_Dijkstra)->Apply(shapes);
+BENCHMARK(BM_DijkstraMap)->Apply(shapes);
+BENCHMARK(BM_ShortestPath)->Apply(shapes);
+BENCHMARK(BM_AStar)->Apply(shapes);
+BENCHMARK(BM_AStarBlind)->Apply(shapes);
+BENCHMARK(BM_ContractionHierarchy)->Apply(hierarchyShapes);
+BENCHMARK(BM_DeltaStepping)->Apply(shapes);
+BENCHMARK(BM_Wave)->Apply(shapes);
+BENCHMARK(BM_WaveNearby)->Apply(shapes);
+BENCHMARK(BM_DynamicWeightUpdate)->Apply(shapes);
+BENCHMARK(BM_FloydWarshall)->ArgsProduct({{512, 2048}, {8, 64, 256}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Johnson)->ArgsProduct({{512, 2048}, {8, 64, 256}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DijkstraEachNode)->ArgsProduct({{512, 2048}, {8, 64, 256}})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BellmanFord)->RangeMultiplier(8)->Range(1 << 10, 1 << 13);
+BENCHMARK(BM_Spfa)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
@@ -0,0 +1,236 @@
+#include "graph_generators.h"
+#include "../graph/graph_io.h"
+#include "../graph/concurrent_graph.h"
+#include <sstream>
+#include <benchmark/benchmark.h>
+#include <memory_resource>
+#include <cstdio>
+#include <mutex>
+
+// Бенчмарки построения и изменения графа
+
+static void BM_InsertNode(benchmark::State& state)
+{
+    size_t nodes = state.range(0);
+
+    for (auto _ : state)
+    {
+        DirectedGraph graph;
+        for (size_t key = 0; key < nodes; ++key)
+        {
+            graph.insertNode(key);
+        }
+        benchmark::DoNotOptimize(graph);
+    }
+    state.SetItemsProcessed(state.iterations() * nodes);
+}
+
+static void BM_AddVertex(benchmark::State& state)
+{
+    size_t nodes = state.range(0);
+    size_t vertexes = nodes * 8;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(randomGraph(nodes, vertexes, 42));
+    }
+    state.SetItemsProcessed(state.iterations() * vertexes);
+}
+
+static void BM_AddVertexHub(benchmark::State& state)
+{
+    size_t links = state.range(0);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(powerLawGraph(links * 64, links, 42));
+    }
+    state.SetItemsProcessed(state.iterations() * links * links * 64);
+}
+
+static void BM_RemoveNode(benchmark::State& state)
+{
+    size_t nodes = state.range(0);
+    DirectedGraph original = randomGraph(nodes, nodes * 8, 42);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        DirectedGraph graph(original);
+        state.ResumeTiming();
+
+        // Удаляем узлы от последнего к первому
+        for (size_t key = nodes; key > nodes - 64; --key)
+        {
+            graph.removeNode(key - 1);
+        }
+        benchmark::DoNotOptimize(graph);
+    }
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+
+static void BM_CopyGraph(benchmark::State& state)
+{
+    size_t nodes = state.range(0);
+    DirectedGraph original = randomGraph(nodes, nodes * 8, 42);
+
+    for (auto _ : state)
+    {
+        DirectedGraph copy(original);
+        benchmark::DoNotOptimize(copy);
+    }
+    state.SetItemsProcessed(state.iterations() * nodes);
+}
+
+// Проверки рёбер из нескольких потоков: граф под общей блокировкой и ConcurrentGraph
+static void BM_LockedReads(benchmark::State& state)
+{
+    static std::mutex mutex;
+    static DirectedGraph graph = randomGraph(1 << 14, (1 << 14) * 8, 42);
+    std::mt19937_64 generator(state.thread_index());
+    std::uniform_int_distribution<size_t> node(0, (1 << 14) - 1);
+
+    for (auto _ : state)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        benchmark::DoNotOptimize(graph.hasVertex(node(generator), node(generator)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_ConcurrentReads(benchmark::State& state)
+{
+    static ConcurrentGraph graph(randomGraph(1 << 14, (1 << 14) * 8, 42));
+    std::mt19937_64 generator(state.thread_index());
+    std::uniform_int_distribution<size_t> node(0, (1 << 14) - 1);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.hasVertex(node(generator), node(generator)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Изменение веса одного ребра в ConcurrentGraph: публикация версии после каждой записи
+static void BM_ConcurrentUpdate(benchmark::State& state)
+{
+    size_t nodes = state.range(0);
+    DirectedGraph source = randomGraph(nodes, nodes * 8, 42);
+    std::vector<DirectedGraph::VertexRecord> vertexes;
+    source.forEachVertex([&](size_t origin, double weight, size_t destination)
+    {
+        vertexes.push_back({origin, weight, destination});
+    });
+    ConcurrentGraph graph(source);
+    std::mt19937_64 generator(42);
+    std::uniform_int_distribution<size_t> vertex(0, vertexes.size() - 1);
+
+    for (auto _ : state)
+    {
+        const DirectedGraph::VertexRecord& record = vertexes[vertex(generator)];
+        graph.addVertex(record.origin, record.weight + 1.0, record.destination);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Построение графа пакетом рёбер и его удаление; второй аргумент — 1, если пул берёт память
+// из монотонного буфера, освобождаемого целиком
+static void BM_BuildAndDestroy(benchmark::State& state)
+{
+    size_t nodes = state.range(0);
+    bool monotonic = state.range(1) != 0;
+    std::vector<DirectedGraph::VertexRecord> records;
+    randomGraph(nodes, nodes * 8, 42).forEachVertex([&records](size_t origin, double weight, size_t destination)
+    {
+        records.push_back({origin, weight, destination});
+    });
+
+    for (auto _ : state)
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        DirectedGraph graph(nodes, monotonic ? &arena : std::pmr::get_default_resource());
+        graph.addVertexes(records);
+        benchmark::DoNotOptimize(graph);
+    }
+    state.SetItemsProcessed(state.iterations() * records.size());
+}
+
+static void BM_ReadData(benchmark::State& state)
+{
+    size_t nodes = state.range(0);
+    size_t vertexes = nodes * 8;
+    std::string fileName = "bench_edges_" + std::to_string(nodes) + ".txt";
+    writeEdgeFile(fileName, nodes, vertexes, 42);
+
+    for (auto _ : state)
+    {
+        DirectedGraph graph;
+        benchmark::DoNotOptimize(readData(fileName, graph));
+    }
+    state.SetItemsProcessed(state.iterations() * vertexes);
+    std::remove(fileName.c_str());
+}
+
+// Загрузка крупного файла рёбер с разным числом потоков разбора
+static void BM_LoadGraph(benchmark::State& state)
+{
+    size_t nodes = 1 << 17;
+    size_t vertexes = nodes * 8;
+    size_t threads = state.range(0);
+    std::string fileName = "bench_load_" + std::to_string(threads) + ".txt";
+    writeEdgeFile(fileName, nodes, vertexes, 42);
+
+    for (auto _ : state)
+    {
+        DirectedGraph graph;
+        benchmark::DoNotOptimize(loadGraph(fileName, graph, threads));
+    }
+    state.SetItemsProcessed(state.iterations() * vertexes);
+    std::remove(fileName.c_str());
+}
+
+// Открытие двоичного снимка того же размера (отображение без разбора) и первый запрос
+static void BM_LoadSnapshot(benchmark::State& state)
+{
+    size_t nodes = 1 << 17;
+    std::string fileName = "bench_snapshot.bin";
+    randomGraph(nodes, nodes * 8, 42).freeze().save(fileName);
+
+    for (auto _ : state)
+    {
+        CompressedGraph snapshot = CompressedGraph::load(fileName, state.range(0) != 0);
+        benchmark::DoNotOptimize(snapshot.wave(0, 1));
+    }
+    state.SetItemsProcessed(state.iterations() * nodes * 8);
+    std::remove(fileName.c_str());
+}
+
+// Запись графа в память в заданном формате
+static void BM_WriteGraph(benchmark::State& state)
+{
+    size_t nodes = 1 << 16;
+    DirectedGraph graph = randomGraph(nodes, nodes * 8, 42);
+    GraphFormat format = static_cast<GraphFormat>(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::ostringstream out;
+        writeGraph(out, graph, format);
+        benchmark::DoNotOptimize(out.tellp());
+    }
+    state.SetItemsProcessed(state.iterations() * nodes * 8);
+}
+
+BENCHMARK(BM_InsertNode)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_AddVertex)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_AddVertexHub)->RangeMultiplier(2)->Range(8, 32);
+BENCHMARK(BM_RemoveNode)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_CopyGraph)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_LockedReads)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ConcurrentReads)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ConcurrentUpdate)->RangeMultiplier(16)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_BuildAndDestroy)->ArgsProduct({{1 << 10, 1 << 13, 1 << 16}, {0, 1}});
+BENCHMARK(BM_ReadData)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_LoadGraph)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_WriteGraph)->DenseRange(0, 3)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadSnapshot)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
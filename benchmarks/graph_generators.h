@@ -0,0 +1,142 @@
+#ifndef GRAPHGENERATORS_H
+#define GRAPHGENERATORS_H
+
+#include "../graph/directed_graph.h"
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <string>
+#include <fstream>
+
+// Генераторы синтетических графов для бенчмарков.
+// Граф не допускает встречных рёбер, поэтому такие пары пропускаются
+
+// Случайный граф G(n, m) с весами из [minWeight, maxWeight]
+inline DirectedGraph randomGraph(size_t nodes, size_t vertexes, unsigned seed, double minWeight = 1.0, double maxWeight = 100.0)
+{
+    std::mt19937_64 generator(seed);
+    std::uniform_int_distribution<size_t> node(0, nodes - 1);
+    std::uniform_real_distribution<double> weight(minWeight, maxWeight);
+
+    DirectedGraph graph(nodes);
+    for (size_t i = 0; i < nodes; ++i)
+    {
+        graph.insertNode(i);
+    }
+    for (size_t i = 0; i < vertexes; ++i)
+    {
+        size_t origin = node(generator);
+        size_t destination = node(generator);
+        if (origin == destination) continue;
+
+        try
+        {
+            graph.addVertex(origin, weight(generator), destination);
+        }
+        catch(const std::logic_error&)
+        {
+            // Встречное ребро уже есть
+        }
+    }
+    return graph;
+}
+
+// Решётка rows x columns с рёбрами вправо и вниз (похожа на дорожную сеть)
+inline DirectedGraph gridGraph(size_t rows, size_t columns, unsigned seed, double minWeight = 1.0, double maxWeight = 100.0)
+{
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> weight(minWeight, maxWeight);
+
+    DirectedGraph graph(rows * columns);
+    for (size_t i = 0; i < rows * columns; ++i)
+    {
+        graph.insertNode(i);
+    }
+    for (size_t row = 0; row < rows; ++row)
+    {
+        for (size_t column = 0; column < columns; ++column)
+        {
+            size_t key = row * columns + column;
+            if (column + 1 < columns) graph.addVertex(key, weight(generator), key + 1);
+            if (row + 1 < rows) graph.addVertex(key, weight(generator), key + columns);
+        }
+    }
+    return graph;
+}
+// Граф со степенным распределением степеней (предпочтительное присоединение):
+// каждый новый узел соединяется с links узлами, выбранными пропорционально их степени
+inline DirectedGraph powerLawGraph(size_t nodes, size_t links, unsigned seed, double minWeight = 1.0, double maxWeight = 100.0)
+{
+    std::mt19937_64 generator(seed);
+    std::uniform_real_distribution<double> weight(minWeight, maxWeight);
+    std::bernoulli_distribution outgoing(0.5);
+
+    DirectedGraph graph(nodes);
+    std::vector<size_t> endpoints; // Каждый узел входит сюда столько раз, какова его степень
+    graph.insertNode(0);
+    endpoints.push_back(0);
+
+    for (size_t key = 1; key < nodes; ++key)
+    {
+        graph.insertNode(key);
+        for (size_t i = 0; i < links; ++i)
+        {
+            size_t target = endpoints[std::uniform_int_distribution<size_t>(0, endpoints.size() - 1)(generator)];
+            try
+            {
+                if (outgoing(generator)) graph.addVertex(key, weight(generator), target);
+                else graph.addVertex(target, weight(generator), key);
+                endpoints.push_back(target);
+            }
+            catch(const std::logic_error&)
+            {
+                // Встречное ребро уже есть
+            }
+        }
+        endpoints.push_back(key);
+    }
+    return graph;
+}
+
+// Ациклический граф с отрицательными весами (рёбра только от меньшего номера к большему)
+inline DirectedGraph negativeDagGraph(size_t nodes, size_t vertexes, unsigned seed, double minWeight = -10.0, double maxWeight = 100.0)
+{
+    std::mt19937_64 generator(seed);
+    std::uniform_int_distribution<size_t> node(0, nodes - 1);
+    std::uniform_real_distribution<double> weight(minWeight, maxWeight);
+
+    DirectedGraph graph(nodes);
+    for (size_t i = 0; i < nodes; ++i)
+    {
+        graph.insertNode(i);
+    }
+    for (size_t i = 0; i < vertexes; ++i)
+    {
+        size_t origin = node(generator);
+        size_t destination = node(generator);
+        if (origin == destination) continue;
+        if (origin > destination) std::swap(origin, destination);
+        graph.addVertex(origin, weight(generator), destination);
+    }
+    return graph;
+}
+
+// Запись случайных рёбер G(n, m) в текстовый файл формата "(origin, weight, destination)"
+inline void writeEdgeFile(const std::string& fileName, size_t nodes, size_t vertexes, unsigned seed)
+{
+    std::mt19937_64 generator(seed);
+    std::uniform_int_distribution<size_t> node(0, nodes - 1);
+    std::uniform_real_distribution<double> weight(1.0, 100.0);
+
+    std::ofstream file(fileName);
+    for (size_t i = 0; i < vertexes; ++i)
+    {
+        // Рёбра от меньшего узла к большему, чтобы не было встречных пар
+        size_t origin = node(generator);
+        size_t destination = node(generator);
+        if (origin == destination) continue;
+        if (origin > destination) std::swap(origin, destination);
+        file << "(" << origin << ", " << weight(generator) << ", " << destination << ")\n";
+    }
+}
+#endif
@@ -0,0 +1,40 @@
+#include "graph_generators.h"
+#include <benchmark/benchmark.h>
+
+// Сравнение очередей с приоритетом в алгоритме Дейкстры на разных формах графов
+
+template <class Queue>
+static void BM_DijkstraRandom(benchmark::State& state)
+{
+    size_t nodes = state.range(0);
+    DirectedGraph graph = randomGraph(nodes, nodes * 8, 42);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.dijkstraPaths<Queue>(0));
+    }
+    state.SetItemsProcessed(state.iterations() * nodes);
+}
+
+template <class Queue>
+static void BM_DijkstraGrid(benchmark::State& state)
+{
+    size_t side = state.range(0);
+    DirectedGraph graph = gridGraph(side, side, 42);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(graph.dijkstraPaths<Queue>(0));
+    }
+    state.SetItemsProcessed(state.iterations() * side * side);
+}
+
+BENCHMARK_TEMPLATE(BM_DijkstraRandom, BinaryHeapQueue)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_DijkstraRandom, QuaternaryHeapQueue)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_DijkstraRandom, RadixHeapQueue)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_DijkstraRandom, PairingHeapQueue)->RangeMultiplier(8)->Range(1 << 10, 1 << 16);
+
+BENCHMARK_TEMPLATE(BM_DijkstraGrid, BinaryHeapQueue)->RangeMultiplier(4)->Range(32, 256);
+BENCHMARK_TEMPLATE(BM_DijkstraGrid, QuaternaryHeapQueue)->RangeMultiplier(4)->Range(32, 256);
+BENCHMARK_TEMPLATE(BM_DijkstraGrid, RadixHeapQueue)->RangeMultiplier(4)->Range(32, 256);
+BENCHMARK_TEMPLATE(BM_DijkstraGrid, PairingHeapQueue)->RangeMultiplier(4)->Range(32, 256);
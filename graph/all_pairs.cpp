@@ -0,0 +1,482 @@
+#include "all_pairs.h"
+#include "thread_pool.h"
+#include "priority_queues.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <stdexcept>
+#include <fstream>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static_assert(sizeof(size_t) == sizeof(uint64_t), "Distance matrix file stores node numbers as 64-bit values");
+
+namespace
+{
+    // Выравнивание массивов в файле (размер кэш-линии)
+    constexpr size_t fileAlignment = 64;
+    // Признак порядка байт записавшей машины
+    constexpr uint32_t byteOrderMark = 0x01020304;
+    // Номер строки отсутствующего узла
+    constexpr size_t noRow = std::numeric_limits<size_t>::max();
+    // Сторона блока Флойда — Уоршелла: три блока 64 x 64 (по 32 КиБ) помещаются в кэш второго уровня
+    constexpr size_t blockSize = 64;
+    // Граф считается плотным, если рёбер не меньше V^2 / denseRatio: тогда Флойд — Уоршелл
+    // с векторизованным внутренним циклом быстрее алгоритма Джонсона (по BM_FloydWarshall и BM_Johnson)
+    constexpr size_t denseRatio = 8;
+
+    // Заголовок файла матрицы (за ним следуют номера узлов и строки расстояний, каждый массив выровнен по fileAlignment)
+    struct FileHeader
+    {
+        char magic[8]; // Сигнатура формата (записывается последней, после заполнения матрицы)
+        uint32_t version; // Версия формата
+        uint32_t byteOrder; // byteOrderMark в порядке байт записавшей машины
+        uint64_t count; // Количество узлов
+        uint64_t reserved[5]; // Зарезервировано (нули)
+    };
+    static_assert(sizeof(FileHeader) == fileAlignment, "Distance matrix header must occupy one aligned block");
+
+    constexpr char fileMagic[8] = {'T', 'P', 'D', 'I', 'S', 'T', 'M', '\0'};
+
+    size_t alignUp(size_t value)
+    {
+        return (value + fileAlignment - 1) / fileAlignment * fileAlignment;
+    }
+
+    // Смещение строк расстояний в файле
+    size_t distancesOffset(size_t count)
+    {
+        return alignUp(sizeof(FileHeader) + count * sizeof(size_t));
+    }
+
+    // Размер файла матрицы
+    size_t fileSize(size_t count)
+    {
+        return distancesOffset(count) + count * count * sizeof(double);
+    }
+
+    FileHeader makeHeader(size_t count)
+    {
+        FileHeader header{};
+        std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+        header.version = DistanceMatrix::formatVersion;
+        header.byteOrder = byteOrderMark;
+        header.count = count;
+        return header;
+    }
+
+    // Файл, отображённый в память для чтения и записи.
+    // Новый файл создаётся нужного размера и отображается общим (записи попадают в файл),
+    // существующий — частным (записи остаются в памяти процесса)
+    class FileMapping
+    {
+    public:
+        // Создание файла заданного размера
+        FileMapping(const std::string& fileName, size_t size):
+            size_(size)
+        {
+            int descriptor = ::open(fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+            if (descriptor < 0) throw std::runtime_error("Failed to open file");
+            if (::ftruncate(descriptor, static_cast<off_t>(size_)) != 0)
+            {
+                ::close(descriptor);
+                throw std::runtime_error("Failed to write file");
+            }
+            map(descriptor, MAP_SHARED);
+        }
+
+        // Открытие существующего файла
+        explicit FileMapping(const std::string& fileName)
+        {
+            int descriptor = ::open(fileName.c_str(), O_RDONLY);
+            if (descriptor < 0) throw std::runtime_error("Failed to open file");
+
+            struct stat info;
+            if (::fstat(descriptor, &info) != 0)
+            {
+                ::close(descriptor);
+                throw std::runtime_error("Failed to open file");
+            }
+            size_ = static_cast<size_t>(info.st_size);
+            map(descriptor, MAP_PRIVATE);
+        }
+
+        FileMapping(const FileMapping&) = delete;
+        FileMapping& operator=(const FileMapping&) = delete;
+
+        ~FileMapping()
+        {
+            if (data_ != nullptr) ::munmap(data_, size_);
+        }
+
+        char* data() const
+        {
+            return data_;
+        }
+
+        size_t size() const
+        {
+            return size_;
+        }
+
+    private:
+        char* data_ = nullptr; // Начало отображения
+        size_t size_ = 0; // Размер файла
+
+        void map(int descriptor, int flags)
+        {
+            if (size_ != 0)
+            {
+                void* address = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, flags, descriptor, 0);
+                if (address == MAP_FAILED)
+                {
+                    ::close(descriptor);
+                    throw std::runtime_error("Failed to map file");
+                }
+                data_ = static_cast<char*>(address);
+            }
+            ::close(descriptor); // Отображение остаётся действительным после закрытия дескриптора
+        }
+    };
+
+    // Релаксация блока строк [iBegin, iEnd) и столбцов [jBegin, jEnd) через узлы [kBegin, kEnd):
+    // d[i][j] = min(d[i][j], d[i][k] + d[k][j]). Внутренний цикл идёт по подряд лежащим
+    // элементам строк без ветвлений, поэтому компилятор векторизует его (minpd/vminpd)
+    void relaxBlock(double* distances, size_t count, size_t iBegin, size_t jBegin, size_t kBegin)
+    {
+        const double infinity = std::numeric_limits<double>::infinity();
+        size_t iEnd = std::min(iBegin + blockSize, count);
+        size_t jEnd = std::min(jBegin + blockSize, count);
+        size_t kEnd = std::min(kBegin + blockSize, count);
+
+        for (size_t k = kBegin; k < kEnd; ++k)
+        {
+            const double* rowK = distances + k * count;
+            for (size_t i = iBegin; i < iEnd; ++i)
+            {
+                double* rowI = distances + i * count;
+                double throughK = rowI[k];
+                if (throughK == infinity) continue; // Через k из i не пройти
+
+                for (size_t j = jBegin; j < jEnd; ++j)
+                {
+                    rowI[j] = std::min(rowI[j], throughK + rowK[j]);
+                }
+            }
+        }
+    }
+
+    // Номера существующих узлов графа по возрастанию
+    std::vector<size_t> graphNodes(const DirectedGraph& graph)
+    {
+        std::vector<size_t> nodes;
+        nodes.reserve(graph.size());
+        graph.forEachNode([&](size_t key) { nodes.push_back(key); });
+        return nodes;
+    }
+}
+
+// Конструкторы
+
+DistanceMatrix::DistanceMatrix():
+    distances_(nullptr),
+    file_(nullptr)
+{}
+
+DistanceMatrix::DistanceMatrix(std::vector<size_t> nodes, const std::string& spillFile):
+    nodes_(std::move(nodes)),
+    distances_(nullptr),
+    file_(nullptr)
+{
+    indexNodes();
+    size_t count = nodes_.size();
+
+    if (spillFile.empty())
+    {
+        auto buffer = std::make_shared<std::vector<double>>(count * count);
+        distances_ = buffer->data();
+        storage_ = std::move(buffer);
+        return;
+    }
+
+    // Матрица в файле: номера узлов записываются сразу, заголовок — после заполнения (complete)
+    auto mapping = std::make_shared<FileMapping>(spillFile, fileSize(count));
+    std::memcpy(mapping->data() + sizeof(FileHeader), nodes_.data(), count * sizeof(size_t));
+    distances_ = reinterpret_cast<double*>(mapping->data() + distancesOffset(count));
+    file_ = mapping->data();
+    storage_ = std::move(mapping);
+}
+
+// Приватные методы
+
+void DistanceMatrix::indexNodes()
+{
+    rows_.assign(nodes_.empty() ? 0 : nodes_.back() + 1, noRow);
+    for (size_t index = 0; index < nodes_.size(); ++index)
+    {
+        rows_[nodes_[index]] = index;
+    }
+}
+
+size_t DistanceMatrix::rowOf(size_t key) const
+{
+    if (contains(key) == false) throw std::invalid_argument("This node is not in the graph");
+    return rows_[key];
+}
+
+double* DistanceMatrix::mutableRow(size_t index)
+{
+    return distances_ + index * nodes_.size();
+}
+
+void DistanceMatrix::complete()
+{
+    // Заголовок с сигнатурой появляется в файле выгрузки только у полностью заполненной матрицы
+    if (file_ == nullptr) return;
+    FileHeader header = makeHeader(nodes_.size());
+    std::memcpy(file_, &header, sizeof(header));
+}
+
+// Публичные методы
+
+size_t DistanceMatrix::size() const
+{
+    return nodes_.size();
+}
+
+const std::vector<size_t>& DistanceMatrix::nodes() const
+{
+    return nodes_;
+}
+
+bool DistanceMatrix::contains(size_t key) const
+{
+    return (key < rows_.size()) && (rows_[key] != noRow);
+}
+
+double DistanceMatrix::distance(size_t origin, size_t destination) const
+{
+    size_t destinationRow = rowOf(destination);
+    return row(origin)[destinationRow];
+}
+
+const double* DistanceMatrix::row(size_t origin) const
+{
+    return distances_ + rowOf(origin) * nodes_.size();
+}
+
+void DistanceMatrix::save(const std::string& fileName) const
+{
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) throw std::runtime_error("Failed to open file");
+
+    size_t count = nodes_.size();
+    FileHeader header = makeHeader(count);
+    const char zeros[fileAlignment] = {};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(nodes_.data()), count * sizeof(size_t));
+    file.write(zeros, distancesOffset(count) - sizeof(header) - count * sizeof(size_t));
+    file.write(reinterpret_cast<const char*>(distances_), count * count * sizeof(double));
+
+    file.flush();
+    if (!file) throw std::runtime_error("Failed to write file");
+}
+
+DistanceMatrix DistanceMatrix::open(const std::string& fileName)
+{
+    auto mapping = std::make_shared<FileMapping>(fileName);
+
+    // Проверка заголовка и размеров
+    if (mapping->size() < sizeof(FileHeader)) throw std::runtime_error("Distance matrix file is truncated");
+    FileHeader header;
+    std::memcpy(&header, mapping->data(), sizeof(header));
+    if (std::memcmp(header.magic, fileMagic, sizeof(fileMagic)) != 0) throw std::runtime_error("File is not a distance matrix");
+    if (header.version != formatVersion) throw std::runtime_error("Unsupported distance matrix format version");
+    if (header.byteOrder != byteOrderMark) throw std::runtime_error("Distance matrix was written with a different byte order");
+    if (header.count > mapping->size() / sizeof(double) || fileSize(header.count) != mapping->size())
+    {
+        throw std::runtime_error("Distance matrix file is truncated");
+    }
+
+    // Номера узлов должны возрастать
+    DistanceMatrix matrix;
+    matrix.nodes_.resize(header.count);
+    std::memcpy(matrix.nodes_.data(), mapping->data() + sizeof(FileHeader), header.count * sizeof(size_t));
+    for (size_t index = 1; index < matrix.nodes_.size(); ++index)
+    {
+        if (matrix.nodes_[index - 1] >= matrix.nodes_[index]) throw std::runtime_error("Distance matrix file is corrupted");
+    }
+
+    matrix.indexNodes();
+    matrix.distances_ = reinterpret_cast<double*>(mapping->data() + distancesOffset(header.count));
+    matrix.storage_ = std::move(mapping);
+    return matrix;
+}
+
+// Алгоритмы
+
+DistanceMatrix floydWarshall(const DirectedGraph& graph, size_t threads, const std::string& spillFile)
+{
+    DistanceMatrix matrix(graphNodes(graph), spillFile);
+    size_t count = matrix.size();
+    double* distances = matrix.mutableRow(0);
+
+    // Начальные значения: нули на диагонали, веса рёбер, остальное недостижимо
+    for (size_t index = 0; index < count; ++index)
+    {
+        double* row = matrix.mutableRow(index);
+        std::fill(row, row + count, std::numeric_limits<double>::infinity());
+        row[index] = 0.0;
+    }
+    graph.forEachVertex([&](size_t origin, double weight, size_t destination)
+    {
+        double& value = matrix.mutableRow(matrix.rows_[origin])[matrix.rows_[destination]];
+        value = std::min(value, weight); // Петля с отрицательным весом остаётся на диагонали
+    });
+
+    // Для каждого блока k: сначала диагональный блок, затем блоки его строки и столбца,
+    // затем все остальные блоки; блоки второй и третьей фазы не зависят друг от друга
+    ThreadPool pool(threads);
+    size_t blocks = (count + blockSize - 1) / blockSize;
+    for (size_t k = 0; k < blocks; ++k)
+    {
+        size_t kBegin = k * blockSize;
+        relaxBlock(distances, count, kBegin, kBegin, kBegin);
+
+        pool.parallelFor(blocks, [&](size_t, size_t begin, size_t end)
+        {
+            for (size_t block = begin; block < end; ++block)
+            {
+                if (block == k) continue;
+                relaxBlock(distances, count, kBegin, block * blockSize, kBegin);
+                relaxBlock(distances, count, block * blockSize, kBegin, kBegin);
+            }
+        });
+
+        pool.parallelFor(blocks, [&](size_t, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (i == k) continue;
+                for (size_t j = 0; j < blocks; ++j)
+                {
+                    if (j != k) relaxBlock(distances, count, i * blockSize, j * blockSize, kBegin);
+                }
+            }
+        });
+    }
+
+    // Отрицательное расстояние от узла до самого себя означает цикл отрицательного веса
+    for (size_t index = 0; index < count; ++index)
+    {
+        if (matrix.mutableRow(index)[index] < 0) throw std::logic_error("Graph contains a negative-weight cycle");
+    }
+
+    matrix.complete();
+    return matrix;
+}
+
+DistanceMatrix johnson(const DirectedGraph& graph, size_t threads, const std::string& spillFile)
+{
+    DistanceMatrix matrix(graphNodes(graph), spillFile);
+    size_t count = matrix.size();
+
+    // Рёбра в формате CSR по номерам строк (forEachVertex обходит источники по возрастанию)
+    std::vector<size_t> offsets(count + 1, 0);
+    std::vector<size_t> targets;
+    std::vector<double> weights;
+    graph.forEachVertex([&](size_t origin, double weight, size_t destination)
+    {
+        offsets[matrix.rows_[origin] + 1]++;
+        targets.push_back(matrix.rows_[destination]);
+        weights.push_back(weight);
+    });
+    for (size_t index = 0; index < count; ++index)
+    {
+        offsets[index + 1] += offsets[index];
+    }
+
+    // Потенциалы узлов: алгоритм Беллмана — Форда из фиктивного узла с рёбрами нулевого веса ко всем узлам
+    std::vector<double> potentials(count, 0.0);
+    for (size_t round = 0; ; ++round)
+    {
+        bool changed = false;
+        for (size_t origin = 0; origin < count; ++origin)
+        {
+            for (size_t edge = offsets[origin]; edge < offsets[origin + 1]; ++edge)
+            {
+                double newPotential = potentials[origin] + weights[edge];
+                if (newPotential < potentials[targets[edge]])
+                {
+                    potentials[targets[edge]] = newPotential;
+                    changed = true;
+                }
+            }
+        }
+        if (!changed) break;
+        if (round == count) throw std::logic_error("Graph contains a negative-weight cycle"); // Изменения после V + 1 проходов
+    }
+
+    // Перевзвешивание: w(u, v) + p(u) - p(v) >= 0 (ошибки округления обрезаются до нуля)
+    for (size_t origin = 0; origin < count; ++origin)
+    {
+        for (size_t edge = offsets[origin]; edge < offsets[origin + 1]; ++edge)
+        {
+            weights[edge] = std::max(0.0, weights[edge] + potentials[origin] - potentials[targets[edge]]);
+        }
+    }
+
+    // Алгоритм Дейкстры из каждого узла прямо в строку матрицы; потоки разбирают источники по одному
+    ThreadPool pool(threads);
+    std::atomic<size_t> next(0);
+    pool.runOnEach([&](size_t, size_t, size_t)
+    {
+        BinaryHeapQueue queue;
+        for (size_t source = next++; source < count; source = next++)
+        {
+            double* row = matrix.mutableRow(source);
+            std::fill(row, row + count, std::numeric_limits<double>::infinity());
+            row[source] = 0.0;
+            queue.reset(count);
+            queue.push(0.0, source);
+
+            while (!queue.empty())
+            {
+                auto [currentDist, currentNode] = queue.pop();
+                if (currentDist > row[currentNode]) continue; // Устаревшая пара из очереди
+
+                for (size_t edge = offsets[currentNode]; edge < offsets[currentNode + 1]; ++edge)
+                {
+                    double newDist = currentDist + weights[edge];
+                    if (newDist < row[targets[edge]])
+                    {
+                        row[targets[edge]] = newDist;
+                        queue.push(newDist, targets[edge]);
+                    }
+                }
+            }
+
+            // Возврат к исходным весам: d(s, v) = d'(s, v) - p(s) + p(v)
+            for (size_t index = 0; index < count; ++index)
+            {
+                if (row[index] != std::numeric_limits<double>::infinity()) row[index] += potentials[index] - potentials[source];
+            }
+        }
+    });
+
+    matrix.complete();
+    return matrix;
+}
+
+DistanceMatrix allPairsShortestPaths(const DirectedGraph& graph, size_t threads, const std::string& spillFile)
+{
+    size_t vertexes = 0;
+    graph.forEachVertex([&](size_t, double, size_t) { vertexes++; });
+
+    size_t nodes = graph.size();
+    if (vertexes * denseRatio >= nodes * nodes) return floydWarshall(graph, threads, spillFile);
+    return johnson(graph, threads, spillFile);
+}
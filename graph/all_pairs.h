@@ -0,0 +1,80 @@
+#ifndef ALLPAIRS_H
+#define ALLPAIRS_H
+
+#include "directed_graph.h"
+#include <vector>
+#include <memory>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+// Матрица кратчайших расстояний между всеми парами узлов графа.
+// Строки и столбцы соответствуют существующим узлам в порядке возрастания номеров.
+// Матрица хранится в памяти или, если задан файл выгрузки, в отображённом в память файле
+// (тогда её размер ограничен диском, а не оперативной памятью); копии матрицы разделяют одну память
+class DistanceMatrix
+{
+public:
+    // Версия двоичного формата файла матрицы
+    static constexpr uint32_t formatVersion = 1;
+
+    // Конструктор по умолчанию (пустая матрица)
+    DistanceMatrix();
+
+    // Методы
+
+    // Получение количества узлов (строк матрицы)
+    size_t size() const;
+    // Получение номеров узлов в порядке строк
+    const std::vector<size_t>& nodes() const;
+    // Проверка, существовал ли узел в графе на момент построения
+    bool contains(size_t key) const;
+    // Расстояние между узлами (бесконечность, если путь не существует)
+    double distance(size_t origin, size_t destination) const;
+    // Строка расстояний от узла до всех узлов в порядке nodes()
+    const double* row(size_t origin) const;
+
+    // Запись матрицы в двоичный файл (в том же формате, что и файл выгрузки).
+    // Выбрасывает std::runtime_error при ошибке записи
+    void save(const std::string& fileName) const;
+    // Открытие файла матрицы (записанного save или выгрузкой) отображением в память.
+    // Выбрасывает std::runtime_error, если файл не удалось открыть или он повреждён
+    static DistanceMatrix open(const std::string& fileName);
+
+private:
+    // Матрицу заполняют только алгоритмы поиска путей между всеми парами узлов
+    friend DistanceMatrix floydWarshall(const DirectedGraph& graph, size_t threads, const std::string& spillFile);
+    friend DistanceMatrix johnson(const DirectedGraph& graph, size_t threads, const std::string& spillFile);
+
+    // Конструктор с параметрами: строки для узлов nodes, память в spillFile (пустая строка — в оперативной памяти)
+    DistanceMatrix(std::vector<size_t> nodes, const std::string& spillFile);
+
+    std::vector<size_t> nodes_; // Номера узлов в порядке строк
+    std::vector<size_t> rows_; // Номер строки узла по его номеру (noRow для отсутствующих)
+    double* distances_; // Расстояния по строкам (size() * size() значений)
+    char* file_; // Начало файла выгрузки (nullptr для матрицы в памяти)
+    std::shared_ptr<void> storage_; // Владелец памяти расстояний: массив или отображённый файл
+
+    // Методы
+
+    // Построение rows_ по nodes_
+    void indexNodes();
+    // Номер строки узла; выбрасывает std::invalid_argument, если узла нет
+    size_t rowOf(size_t key) const;
+    // Изменяемая строка расстояний по её номеру
+    double* mutableRow(size_t index);
+    // Завершение заполнения: запись заголовка в файл выгрузки
+    void complete();
+};
+
+// Блочный алгоритм Флойда — Уоршелла для плотных графов: O(V^3) операций над блоками,
+// помещающимися в кэш. Потоков threads (0 — по числу ядер), матрица выгружается в spillFile, если он задан.
+// Выбрасывает std::logic_error при наличии цикла отрицательного веса
+DistanceMatrix floydWarshall(const DirectedGraph& graph, size_t threads = 0, const std::string& spillFile = "");
+// Алгоритм Джонсона для разреженных графов (допускает отрицательные веса): потенциалы узлов
+// по Беллману — Форду и параллельный алгоритм Дейкстры из каждого узла на перевзвешенных рёбрах.
+// Выбрасывает std::logic_error при наличии цикла отрицательного веса
+DistanceMatrix johnson(const DirectedGraph& graph, size_t threads = 0, const std::string& spillFile = "");
+// Выбор алгоритма по плотности графа: Флойд — Уоршелл для плотных, Джонсон для разреженных
+DistanceMatrix allPairsShortestPaths(const DirectedGraph& graph, size_t threads = 0, const std::string& spillFile = "");
+#endif
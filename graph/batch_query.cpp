@@ -0,0 +1,94 @@
+#include "batch_query.h"
+#include <atomic>
+#include <stdexcept>
+
+BatchQueryEngine::BatchQueryEngine(const DirectedGraph& graph, size_t threads):
+    graph_(graph),
+    pool_(threads),
+    scratch_(pool_.size())
+{}
+
+// Приватные методы
+
+void BatchQueryEngine::runQuery(const Query& query, bool onlyPositive, Scratch& scratch, QueryResult& result) const
+{
+    result.error = nullptr;
+    result.distance = 0.0;
+
+    try
+    {
+        // Проверка на существование узлов
+        if (graph_.searchNode(query.origin) == false) throw std::invalid_argument("Origin node does not exist");
+        bool toAll = (query.destination == DirectedGraph::unreachable);
+        if (!toAll && graph_.searchNode(query.destination) == false) throw std::invalid_argument("Destination node does not exist");
+
+        switch (query.algorithm)
+        {
+        case QueryAlgorithm::Dijkstra:
+            if (!onlyPositive) throw std::logic_error("This graph contains vertexes with negative weights, which prevents Dijkstra's algorithm from running");
+            graph_.dijkstraInto(query.origin, query.destination, scratch.queue, result.paths);
+            break;
+        case QueryAlgorithm::BellmanFord:
+            graph_.bellmanFordInto(query.origin, scratch.starts, scratch.destinations, scratch.weights, result.paths);
+            break;
+        case QueryAlgorithm::Wave:
+            graph_.waveInto(query.origin, query.destination, scratch.nodes, result.paths);
+            if (!toAll && !result.paths.isReachable(query.destination)) throw std::logic_error("No path exists between the nodes");
+            break;
+        }
+
+        if (!toAll) result.distance = result.paths.distance(query.destination);
+    }
+    catch(...)
+    {
+        result.error = std::current_exception();
+    }
+}
+
+// Публичные методы
+
+size_t BatchQueryEngine::threads() const
+{
+    return pool_.size();
+}
+
+void BatchQueryEngine::run(const std::vector<Query>& queries, std::vector<QueryResult>& results)
+{
+    results.resize(queries.size());
+
+    // Проверка весов нужна только запросам Дейкстры и выполняется один раз на пакет
+    bool onlyPositive = true;
+    for (const auto& query : queries)
+    {
+        if (query.algorithm == QueryAlgorithm::Dijkstra)
+        {
+            onlyPositive = graph_.isOnlyPositiveVertexes();
+            break;
+        }
+    }
+
+    // Потоки разбирают запросы по одному, чтобы тяжёлые запросы не скапливались у одного потока.
+    // Состояние пакета передаётся одной ссылкой, чтобы задача пула помещалась в std::function без выделения памяти
+    struct Batch
+    {
+        const std::vector<Query>& queries;
+        std::vector<QueryResult>& results;
+        bool onlyPositive;
+        std::atomic<size_t> next;
+    } batch{queries, results, onlyPositive, {0}};
+
+    pool_.runOnEach([this, &batch](size_t thread, size_t, size_t)
+    {
+        for (size_t i = batch.next.fetch_add(1); i < batch.queries.size(); i = batch.next.fetch_add(1))
+        {
+            runQuery(batch.queries[i], batch.onlyPositive, scratch_[thread], batch.results[i]);
+        }
+    });
+}
+
+std::vector<QueryResult> BatchQueryEngine::run(const std::vector<Query>& queries)
+{
+    std::vector<QueryResult> results;
+    run(queries, results);
+    return results;
+}
@@ -0,0 +1,74 @@
+#ifndef BATCHQUERY_H
+#define BATCHQUERY_H
+
+#include "directed_graph.h"
+#include "thread_pool.h"
+#include <vector>
+#include <exception>
+
+// Алгоритм пакетного запроса
+enum class QueryAlgorithm
+{
+    Dijkstra,
+    BellmanFord,
+    Wave
+};
+
+// Запрос: алгоритм, исходный узел и (необязательно) узел назначения
+struct Query
+{
+    QueryAlgorithm algorithm;
+    size_t origin;
+    size_t destination = DirectedGraph::unreachable; // unreachable — запрос до всех узлов
+};
+
+// Результат запроса
+struct QueryResult
+{
+    ShortestPaths paths; // Расстояния и предки (для запроса к одному узлу окончательны только значения на пути до него)
+    double distance = 0.0; // Расстояние до узла назначения (для Wave — число рёбер)
+    std::exception_ptr error; // Исключение, выброшенное при выполнении запроса
+
+    // Проверка успешности запроса
+    bool ok() const
+    {
+        return !error;
+    }
+};
+
+// Движок пакетных запросов: выполняет запросы параллельно на пуле потоков.
+// У каждого потока свои буферы, поэтому повторные пакеты не выделяют память
+class BatchQueryEngine
+{
+public:
+    // Конструктор с параметрами (threads == 0 — по числу ядер); граф не должен меняться во время run
+    explicit BatchQueryEngine(const DirectedGraph& graph, size_t threads = 0);
+
+    // Методы
+
+    // Получение количества потоков
+    size_t threads() const;
+    // Выполнение пакета; results[i] — результат queries[i], память результатов переиспользуется между вызовами
+    void run(const std::vector<Query>& queries, std::vector<QueryResult>& results);
+    // Выполнение пакета с новыми результатами
+    std::vector<QueryResult> run(const std::vector<Query>& queries);
+
+private:
+    // Буферы одного потока
+    struct Scratch
+    {
+        BinaryHeapQueue queue; // Очередь Дейкстры
+        std::vector<size_t> nodes; // Очередь волнового алгоритма
+        std::vector<size_t> starts; // Рёбра Беллмана — Форда: источники
+        std::vector<size_t> destinations; // Рёбра Беллмана — Форда: назначения
+        std::vector<double> weights; // Рёбра Беллмана — Форда: веса
+    };
+
+    const DirectedGraph& graph_; // Граф, к которому выполняются запросы
+    ThreadPool pool_; // Пул потоков
+    std::vector<Scratch> scratch_; // Буферы по потокам
+
+    // Выполнение одного запроса
+    void runQuery(const Query& query, bool onlyPositive, Scratch& scratch, QueryResult& result) const;
+};
+#endif
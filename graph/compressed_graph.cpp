@@ -0,0 +1,620 @@
+#include "compressed_graph.h"
+#include "directed_graph.h"
+#include "mapped_file.h"
+#include <queue>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <fstream>
+#include <cstring>
+
+static_assert(sizeof(size_t) == sizeof(uint64_t) && sizeof(double) == sizeof(uint64_t), "Snapshot file stores 64-bit arrays as is");
+
+namespace
+{
+    // Выравнивание массивов в файле (размер кэш-линии)
+    constexpr size_t fileAlignment = 64;
+    // Признак порядка байт записавшей машины
+    constexpr uint32_t byteOrderMark = 0x01020304;
+    // Флаг заголовка: все рёбра имеют положительный вес
+    constexpr uint64_t onlyPositiveFlag = 1;
+
+    // Заголовок файла снимка (за ним следуют массивы present, offsets, destinations, weights,
+    // каждый выровнен по fileAlignment; промежутки заполнены нулями)
+    struct FileHeader
+    {
+        char magic[8]; // Сигнатура формата
+        uint32_t version; // Версия формата
+        uint32_t byteOrder; // byteOrderMark в порядке байт записавшей машины
+        uint64_t capacity; // Вместимость снимка
+        uint64_t realSize; // Количество узлов
+        uint64_t vertexCount; // Количество рёбер
+        uint64_t flags; // Флаги снимка
+        uint64_t checksum; // Контрольная сумма всего, что следует за заголовком
+        uint64_t reserved; // Зарезервировано (нули)
+    };
+    static_assert(sizeof(FileHeader) == fileAlignment, "Snapshot header must occupy one aligned block");
+
+    constexpr char fileMagic[8] = {'T', 'P', 'G', 'R', 'A', 'P', 'H', '\0'};
+
+    // Смещения массивов в файле
+    struct FileLayout
+    {
+        size_t present;
+        size_t offsets;
+        size_t destinations;
+        size_t weights;
+        size_t end;
+    };
+
+    size_t alignUp(size_t value)
+    {
+        return (value + fileAlignment - 1) / fileAlignment * fileAlignment;
+    }
+
+    size_t presentWords(size_t capacity)
+    {
+        return (capacity + 63) / 64;
+    }
+
+    FileLayout fileLayout(size_t capacity, size_t vertexCount)
+    {
+        FileLayout layout;
+        layout.present = sizeof(FileHeader);
+        layout.offsets = alignUp(layout.present + presentWords(capacity) * sizeof(uint64_t));
+        layout.destinations = alignUp(layout.offsets + (capacity + 1) * sizeof(size_t));
+        layout.weights = alignUp(layout.destinations + vertexCount * sizeof(size_t));
+        layout.end = layout.weights + vertexCount * sizeof(double);
+        return layout;
+    }
+
+    // Контрольная сумма FNV-1a по 64-битным словам
+    class Checksum
+    {
+    public:
+        void update(const void* data, size_t size)
+        {
+            const char* bytes = static_cast<const char*>(data);
+            for (size_t i = 0; i < size; i += sizeof(uint64_t))
+            {
+                uint64_t word;
+                std::memcpy(&word, bytes + i, sizeof(word));
+                mix(word);
+            }
+        }
+
+        // Учёт нулевого выравнивания
+        void pad(size_t size)
+        {
+            for (size_t i = 0; i < size; i += sizeof(uint64_t)) mix(0);
+        }
+
+        uint64_t value() const
+        {
+            return value_;
+        }
+
+    private:
+        uint64_t value_ = 14695981039346656037ull;
+
+        void mix(uint64_t word)
+        {
+            value_ = (value_ ^ word) * 1099511628211ull;
+        }
+    };
+
+    // Приёмник слов массивов снимка: учитывает их в контрольной сумме и, если задан поток,
+    // записывает в него крупными блоками
+    class SectionSink
+    {
+    public:
+        SectionSink(Checksum& checksum, std::ostream* out):
+            checksum_(checksum),
+            out_(out)
+        {
+            if (out_ != nullptr) buffer_.reserve(bufferWords);
+        }
+
+        template <class T>
+        void put(T value)
+        {
+            static_assert(sizeof(T) == sizeof(uint64_t), "Snapshot arrays consist of 64-bit words");
+            uint64_t word;
+            std::memcpy(&word, &value, sizeof(word));
+            checksum_.update(&word, sizeof(word));
+            if (out_ == nullptr) return;
+
+            buffer_.push_back(word);
+            if (buffer_.size() == bufferWords) flush();
+        }
+
+        // Нулевое выравнивание после массива
+        void pad(size_t size)
+        {
+            for (size_t i = 0; i < size; i += sizeof(uint64_t)) put(uint64_t(0));
+        }
+
+        void flush()
+        {
+            if (out_ == nullptr) return;
+            out_->write(reinterpret_cast<const char*>(buffer_.data()), buffer_.size() * sizeof(uint64_t));
+            buffer_.clear();
+        }
+
+    private:
+        static constexpr size_t bufferWords = 8192;
+
+        Checksum& checksum_; // Контрольная сумма записанных слов
+        std::ostream* out_; // Поток вывода (nullptr — только подсчёт контрольной суммы)
+        std::vector<uint64_t> buffer_; // Слова, ещё не переданные в поток
+    };
+}
+
+// Конструктор
+
+CompressedGraph::CompressedGraph():
+    capacity_(0),
+    realSize_(0),
+    vertexCount_(0),
+    onlyPositive_(true)
+{
+    auto arrays = std::make_shared<Arrays>();
+    arrays->offsets.push_back(0);
+    attach(std::move(arrays));
+}
+
+// Приватные методы
+
+void CompressedGraph::attach(std::shared_ptr<Arrays> arrays)
+{
+    present_ = arrays->present.data();
+    offsets_ = arrays->offsets.data();
+    destinations_ = arrays->destinations.data();
+    weights_ = arrays->weights.data();
+    storage_ = std::move(arrays);
+}
+
+std::vector<bool> CompressedGraph::presentNodes() const
+{
+    std::vector<bool> result(capacity_, false);
+    for (size_t key = 0; key < capacity_; ++key)
+    {
+        if ((present_[key / 64] >> (key % 64)) & 1) result[key] = true;
+    }
+    return result;
+}
+
+// Публичные методы
+
+void CompressedGraph::save(const std::string& fileName) const
+{
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) throw std::runtime_error("Failed to open file");
+
+    save(file);
+    file.flush();
+    if (!file) throw std::runtime_error("Failed to write file");
+}
+
+void CompressedGraph::save(std::ostream& out) const
+{
+    FileLayout layout = fileLayout(capacity_, vertexCount_);
+
+    // Заголовок
+    FileHeader header{};
+    std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.version = formatVersion;
+    header.byteOrder = byteOrderMark;
+    header.capacity = capacity_;
+    header.realSize = realSize_;
+    header.vertexCount = vertexCount_;
+    header.flags = onlyPositive_ ? onlyPositiveFlag : 0;
+
+    // Массивы в порядке их расположения в файле
+    struct Section
+    {
+        const void* data;
+        size_t size;
+        size_t next; // Смещение следующего массива (или конец файла)
+    };
+    const Section sections[] = {
+        {present_, presentWords(capacity_) * sizeof(uint64_t), layout.offsets},
+        {offsets_, (capacity_ + 1) * sizeof(size_t), layout.destinations},
+        {destinations_, vertexCount_ * sizeof(size_t), layout.weights},
+        {weights_, vertexCount_ * sizeof(double), layout.end}
+    };
+
+    // Контрольная сумма считается по тем же байтам, что будут записаны после заголовка
+    Checksum checksum;
+    size_t position = sizeof(FileHeader);
+    for (const auto& section : sections)
+    {
+        checksum.update(section.data, section.size);
+        checksum.pad(section.next - position - section.size);
+        position = section.next;
+    }
+    header.checksum = checksum.value();
+
+    // Запись в поток
+    const char zeros[fileAlignment] = {};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    position = sizeof(FileHeader);
+    for (const auto& section : sections)
+    {
+        out.write(static_cast<const char*>(section.data), section.size);
+        out.write(zeros, section.next - position - section.size);
+        position = section.next;
+    }
+}
+
+void CompressedGraph::writeSnapshot(std::ostream& out, const DirectedGraph& graph)
+{
+    const size_t capacity = graph.size_;
+    const size_t vertexCount = graph.vertexCount_;
+    FileLayout layout = fileLayout(capacity, vertexCount);
+
+    FileHeader header{};
+    std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.version = formatVersion;
+    header.byteOrder = byteOrderMark;
+    header.capacity = capacity;
+    header.realSize = graph.realSize_;
+    header.vertexCount = vertexCount;
+    header.flags = graph.isOnlyPositiveVertexes() ? onlyPositiveFlag : 0;
+
+    // Массивы формируются по узлам графа в порядке их расположения в файле (как у freeze)
+    auto emit = [&](SectionSink& sink)
+    {
+        const size_t words = presentWords(capacity);
+        for (size_t word = 0; word < words; ++word)
+        {
+            uint64_t bits = 0;
+            for (size_t key = word * 64; key < std::min(capacity, word * 64 + 64); ++key)
+            {
+                if (graph.outgoing(key)) bits |= uint64_t(1) << (key % 64);
+            }
+            sink.put(bits);
+        }
+        sink.pad(layout.offsets - layout.present - words * sizeof(uint64_t));
+
+        size_t offset = 0;
+        sink.put(offset);
+        for (size_t key = 0; key < capacity; ++key)
+        {
+            if (auto& vertexes = graph.outgoing(key)) offset += vertexes->size();
+            sink.put(offset);
+        }
+        sink.pad(layout.destinations - layout.offsets - (capacity + 1) * sizeof(size_t));
+
+        for (size_t key = 0; key < capacity; ++key)
+        {
+            if (auto& vertexes = graph.outgoing(key))
+            {
+                for (const auto& vertex : *vertexes) sink.put(vertex.destination_);
+            }
+        }
+        sink.pad(layout.weights - layout.destinations - vertexCount * sizeof(size_t));
+
+        for (size_t key = 0; key < capacity; ++key)
+        {
+            if (auto& vertexes = graph.outgoing(key))
+            {
+                for (const auto& vertex : *vertexes) sink.put(vertex.weight_);
+            }
+        }
+        sink.flush();
+    };
+
+    Checksum checksum;
+    auto start = out.tellp();
+    if (start == std::ostream::pos_type(-1))
+    {
+        // Поток без позиционирования: контрольная сумма считается отдельным проходом перед записью
+        SectionSink counter(checksum, nullptr);
+        emit(counter);
+        header.checksum = checksum.value();
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        Checksum unused;
+        SectionSink writer(unused, &out);
+        emit(writer);
+        return;
+    }
+
+    // Контрольная сумма считается при записи и дописывается в заголовок после массивов
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    SectionSink writer(checksum, &out);
+    emit(writer);
+    header.checksum = checksum.value();
+
+    auto end = out.tellp();
+    out.seekp(start);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.seekp(end);
+}
+
+CompressedGraph CompressedGraph::load(const std::string& fileName, bool verify)
+{
+    auto file = std::make_shared<MappedFile>(fileName);
+
+    // Проверяем заголовок
+    if (file->size() < sizeof(FileHeader)) throw std::runtime_error("Snapshot file is truncated");
+    FileHeader header;
+    std::memcpy(&header, file->data(), sizeof(header));
+
+    if (std::memcmp(header.magic, fileMagic, sizeof(fileMagic)) != 0) throw std::runtime_error("File is not a graph snapshot");
+    if (header.version != formatVersion) throw std::runtime_error("Unsupported snapshot format version");
+    if (header.byteOrder != byteOrderMark) throw std::runtime_error("Snapshot was written with a different byte order");
+
+    // Размеры не могут превышать размер файла (защита от переполнения при расчёте смещений)
+    if (header.capacity >= file->size() || header.vertexCount >= file->size() || header.realSize > header.capacity) 
+    {
+        throw std::runtime_error("Snapshot file is corrupted");
+    }
+    FileLayout layout = fileLayout(header.capacity, header.vertexCount);
+    if (layout.end != file->size()) throw std::runtime_error("Snapshot file is truncated");
+
+    // Массивы снимка указывают прямо в отображённый файл
+    CompressedGraph snapshot;
+    snapshot.capacity_ = header.capacity;
+    snapshot.realSize_ = header.realSize;
+    snapshot.vertexCount_ = header.vertexCount;
+    snapshot.onlyPositive_ = (header.flags & onlyPositiveFlag) != 0;
+    snapshot.present_ = reinterpret_cast<const uint64_t*>(file->data() + layout.present);
+    snapshot.offsets_ = reinterpret_cast<const size_t*>(file->data() + layout.offsets);
+    snapshot.destinations_ = reinterpret_cast<const size_t*>(file->data() + layout.destinations);
+    snapshot.weights_ = reinterpret_cast<const double*>(file->data() + layout.weights);
+
+    // Структура массивов проверяется всегда: по ней идут обходы снимка и построение графа из него
+    snapshot.checkStructure();
+    if (verify)
+    {
+        // Флаг положительных весов соответствует весам
+        for (size_t i = 0; i < snapshot.vertexCount_ && snapshot.onlyPositive_; ++i)
+        {
+            if (snapshot.weights_[i] <= 0) throw std::runtime_error("Snapshot file is corrupted");
+        }
+
+        Checksum checksum;
+        checksum.update(file->data() + sizeof(FileHeader), file->size() - sizeof(FileHeader));
+        if (checksum.value() != header.checksum) throw std::runtime_error("Snapshot checksum mismatch");
+    }
+
+    snapshot.storage_ = std::move(file);
+    return snapshot;
+}
+
+void CompressedGraph::checkStructure() const
+{
+    // Смещения начинаются с нуля, не убывают и заканчиваются числом рёбер; рёбра есть только у существующих узлов
+    if (offsets_[0] != 0 || offsets_[capacity_] != vertexCount_) throw std::runtime_error("Snapshot file is corrupted");
+    size_t nodes = 0;
+    for (size_t key = 0; key < capacity_; ++key)
+    {
+        if (offsets_[key] > offsets_[key + 1]) throw std::runtime_error("Snapshot file is corrupted");
+        if (searchNode(key)) nodes++;
+        else if (offsets_[key] != offsets_[key + 1]) throw std::runtime_error("Snapshot file is corrupted");
+    }
+    if (nodes != realSize_) throw std::runtime_error("Snapshot file is corrupted");
+    if (capacity_ % 64 != 0 && (present_[capacity_ / 64] >> (capacity_ % 64)) != 0)
+    {
+        throw std::runtime_error("Snapshot file is corrupted"); // Узлы за пределами вместимости
+    }
+
+    // Рёбра ведут в существующие узлы
+    for (size_t i = 0; i < vertexCount_; ++i)
+    {
+        if (!searchNode(destinations_[i])) throw std::runtime_error("Snapshot file is corrupted");
+    }
+}
+
+bool CompressedGraph::isEmpty() const
+{
+    return realSize_ == 0;
+}
+
+size_t CompressedGraph::size() const
+{
+    return realSize_;
+}
+
+size_t CompressedGraph::vertexCount() const
+{
+    return vertexCount_;
+}
+
+bool CompressedGraph::searchNode(size_t key) const
+{
+    return (key < capacity_) && ((present_[key / 64] >> (key % 64)) & 1);
+}
+
+bool CompressedGraph::hasVertex(size_t origin, size_t destination) const
+{
+    if (searchNode(origin) == false) throw std::invalid_argument("Origin node is not in the graph"); // Проверяем наличие узла источника
+    if (searchNode(destination) == false) throw std::invalid_argument("Destination node is not in the graph"); // Проверяем наличие узла назначения
+
+    for (size_t i = offsets_[origin]; i < offsets_[origin + 1]; ++i)
+    {
+        if (destinations_[i] == destination) return true;
+    }
+    return false;
+}
+
+std::unordered_map<size_t, double> CompressedGraph::dijkstra(size_t origin) const
+{
+    return dijkstraPaths(origin).toMap();
+}
+
+ShortestPaths CompressedGraph::dijkstraPaths(size_t origin) const
+{
+    if (searchNode(origin) == false) throw std::invalid_argument("Origin node does not exist"); // Проверка на существование исходного узла
+    if (!onlyPositive_) throw std::logic_error("This graph contains vertexes with negative weights, which prevents Dijkstra's algorithm from running"); // Проверка что все рёбра положительные
+
+    // Инициализация расстояний
+    std::priority_queue<std::pair<double, size_t>, std::vector<std::pair<double, size_t>>, std::greater<>> queue; // Очередь обхода узлов
+    ShortestPaths result(origin, capacity_); // Плотные массивы расстояний и предков
+    auto& distances = result.distances_;
+
+    result.present_ = presentNodes();
+    distances[origin] = 0.0;
+    queue.emplace(0, origin);
+
+    // Основной цикл обработки узлов
+    while (!queue.empty())
+    {
+        auto [currentDist, currentNode] = queue.top();
+        queue.pop();
+
+        if (currentDist > distances[currentNode]) continue;
+
+        // Обход всех смежных узлов (рёбра лежат в памяти подряд)
+        for (size_t i = offsets_[currentNode]; i < offsets_[currentNode + 1]; ++i)
+        {
+            double newDist = currentDist + weights_[i];
+            size_t destination = destinations_[i];
+
+            // Обновление расстояния, если найден более короткий путь
+            if (newDist < distances[destination])
+            {
+                distances[destination] = newDist;
+                result.predecessors_[destination] = currentNode;
+                queue.emplace(newDist, destination);
+            }
+        }
+    }
+
+    return result;
+}
+
+std::unordered_map<size_t, double> CompressedGraph::bellmanFord(size_t origin) const
+{
+    return bellmanFordPaths(origin).toMap();
+}
+
+ShortestPaths CompressedGraph::bellmanFordPaths(size_t origin) const
+{
+    // Проверка на существование исходного узла
+    if (searchNode(origin) == false) throw std::invalid_argument("Origin node does not exist");
+
+    // Инициализация расстояний
+    const double infinity = std::numeric_limits<double>::infinity();
+    ShortestPaths result(origin, capacity_); // Плотные массивы расстояний и предков
+    auto& distances = result.distances_;
+
+    result.present_ = presentNodes();
+    distances[origin] = 0.0;
+
+    // Релаксация рёбер (не более n-1 итераций)
+    bool changed = true;
+    for (size_t pass = 1; (pass < realSize_) && changed; ++pass)
+    {
+        changed = false;
+        for (size_t start = 0; start < capacity_; ++start)
+        {
+            if (distances[start] == infinity) continue;
+
+            for (size_t i = offsets_[start]; i < offsets_[start + 1]; ++i)
+            {
+                if (distances[start] + weights_[i] < distances[destinations_[i]])
+                {
+                    distances[destinations_[i]] = distances[start] + weights_[i];
+                    result.predecessors_[destinations_[i]] = start;
+                    changed = true;
+                }
+            }
+        }
+    }
+
+    // Проверка на отрицательные циклы (не нужна, если последний проход ничего не изменил)
+    for (size_t start = 0; changed && (start < capacity_); ++start)
+    {
+        if (distances[start] == infinity) continue;
+
+        for (size_t i = offsets_[start]; i < offsets_[start + 1]; ++i)
+        {
+            if (distances[start] + weights_[i] < distances[destinations_[i]])
+            {
+                throw std::logic_error("Graph contains a negative-weight cycle");
+            }
+        }
+    }
+
+    return result;
+}
+
+size_t CompressedGraph::wave(size_t origin, size_t destination) const
+{
+    // Проверка на наличие узлов в графе
+    if (!searchNode(origin)) throw std::invalid_argument("Origin node is not in the graph");
+    if (!searchNode(destination)) throw std::invalid_argument("Destination node is not in the graph");
+    if (origin == destination) return 0;
+
+    // Инициализация расстояний
+    const size_t unvisited = std::numeric_limits<size_t>::max();
+    std::vector<size_t> distances(capacity_, unvisited); // Расстояние от origin до каждого узла
+    std::queue<size_t> nodesQueue; // Очередь обхода узлов
+
+    nodesQueue.push(origin);
+    distances[origin] = 0;
+
+    // Цикл обхода узлов
+    while (!nodesQueue.empty())
+    {
+        size_t currentNode = nodesQueue.front();
+        nodesQueue.pop();
+
+        // Обход всех рёбер текущего узла
+        for (size_t i = offsets_[currentNode]; i < offsets_[currentNode + 1]; ++i)
+        {
+            size_t neighbor = destinations_[i];
+            if (distances[neighbor] != unvisited) continue;
+
+            distances[neighbor] = distances[currentNode] + 1;
+
+            // Если достигли целевого узла, возвращаем расстояние
+            if (neighbor == destination) return distances[neighbor];
+            nodesQueue.push(neighbor);
+        }
+    }
+
+    // Если путь не найден
+    throw std::logic_error("No path exists between the nodes");
+}
+
+ShortestPaths CompressedGraph::wavePaths(size_t origin) const
+{
+    // Проверка на наличие узла в графе
+    if (!searchNode(origin)) throw std::invalid_argument("Origin node is not in the graph");
+
+    // Инициализация расстояний
+    std::queue<size_t> nodesQueue; // Очередь обхода узлов
+    ShortestPaths result(origin, capacity_); // Число рёбер до узлов и предки
+    auto& distances = result.distances_;
+
+    result.present_ = presentNodes();
+    nodesQueue.push(origin);
+    distances[origin] = 0;
+
+    // Цикл обхода узлов
+    while (!nodesQueue.empty()) 
+    {
+        size_t currentNode = nodesQueue.front();
+        nodesQueue.pop();
+
+        // Обход всех рёбер текущего узла
+        for (size_t i = offsets_[currentNode]; i < offsets_[currentNode + 1]; ++i)
+        {
+            size_t neighbor = destinations_[i];
+
+            // Если соседний узел ещё не посещён
+            if (distances[neighbor] == std::numeric_limits<double>::infinity()) 
+            {
+                distances[neighbor] = distances[currentNode] + 1;
+                result.predecessors_[neighbor] = currentNode;
+                nodesQueue.push(neighbor);
+            }
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,103 @@
+#ifndef COMPRESSEDGRAPH_H
+#define COMPRESSEDGRAPH_H
+
+#include <vector>
+#include <unordered_map>
+#include <memory>
+#include <string>
+#include <ostream>
+#include <cstddef>
+#include <cstdint>
+#include "shortest_paths.h"
+
+class DirectedGraph;
+
+// Неизменяемый снимок ориентированного графа в формате CSR (compressed sparse row).
+// Рёбра узла key лежат в destinations_/weights_ на отрезке [offsets_[key], offsets_[key + 1]).
+// Массивы снимка либо принадлежат ему, либо лежат в отображённом в память файле;
+// копии снимка разделяют одну и ту же неизменяемую память
+class CompressedGraph
+{
+public:
+    // Версия двоичного формата файла снимка
+    static constexpr uint32_t formatVersion = 1;
+
+    // Конструктор по умолчанию (пустой снимок)
+    CompressedGraph();
+
+    // Методы
+
+    // Запись снимка в двоичный файл: заголовок, контрольная сумма и выровненные массивы CSR.
+    // Выбрасывает std::runtime_error при ошибке записи
+    void save(const std::string& fileName) const;
+    // Запись снимка в том же формате в двоичный поток (состояние потока проверяет вызывающий)
+    void save(std::ostream& out) const;
+    // Запись графа в том же формате прямо из списков смежности, без построения массивов в памяти
+    // (результат совпадает с graph.freeze().save(out)). Контрольная сумма считается при записи и
+    // дописывается в заголовок; если поток не поддерживает позиционирование, она считается отдельным проходом
+    static void writeSnapshot(std::ostream& out, const DirectedGraph& graph);
+    // Открытие файла снимка отображением в память без копирования массивов.
+    // Заголовок, размеры и структура массивов (смещения не убывают, у отсутствующих узлов нет рёбер,
+    // рёбра ведут в существующие узлы) проверяются всегда за O(V + E); при verify == true также
+    // проверяются веса и контрольная сумма.
+    // Выбрасывает std::runtime_error, если файл не удалось открыть или он повреждён
+    static CompressedGraph load(const std::string& fileName, bool verify = false);
+
+    // Проверка наличия узлов в снимке
+    bool isEmpty() const;
+    // Получение количества узлов в снимке
+    size_t size() const;
+    // Получение количества рёбер в снимке
+    size_t vertexCount() const;
+
+    // Проверка наличия узла в снимке
+    bool searchNode(size_t key) const;
+    // Проверка наличия ребра между заданными узлами
+    bool hasVertex(size_t origin, size_t destination) const;
+
+    // Алгоритм Дейкстры для поиска кратчайших путей
+    std::unordered_map<size_t, double> dijkstra(size_t origin) const;
+    // Алгоритм Беллмана — Форда для поиска кратчайших путей
+    std::unordered_map<size_t, double> bellmanFord(size_t origin) const;
+    // Алгоритм Дейкстры с результатом в плотных массивах (расстояния и предки)
+    ShortestPaths dijkstraPaths(size_t origin) const;
+    // Алгоритм Беллмана — Форда с результатом в плотных массивах (расстояния и предки)
+    ShortestPaths bellmanFordPaths(size_t origin) const;
+    // Волновой алгоритм для поиска кратчайшего пути между заданной парой вершин
+    size_t wave(size_t origin, size_t destination) const;
+    // Волновой алгоритм из заданного узла до всех узлов с деревом предков (расстояние — число рёбер)
+    ShortestPaths wavePaths(size_t origin) const;
+
+private:
+    // Снимок строится только методом DirectedGraph::freeze()
+    friend class DirectedGraph;
+
+    // Собственные массивы снимка, построенного из графа
+    struct Arrays
+    {
+        std::vector<uint64_t> present;
+        std::vector<size_t> offsets;
+        std::vector<size_t> destinations;
+        std::vector<double> weights;
+    };
+
+    size_t capacity_; // Вместимость снимка (номера узлов меньше неё)
+    size_t realSize_; // Количество узлов в снимке
+    size_t vertexCount_; // Количество рёбер в снимке
+    bool onlyPositive_; // Все ли рёбра имеют положительный вес
+    const uint64_t* present_; // Битовая карта существующих узлов (64 узла в слове)
+    const size_t* offsets_; // Начало списка рёбер каждого узла (размер: вместимость + 1)
+    const size_t* destinations_; // Узлы назначения всех рёбер подряд
+    const double* weights_; // Веса всех рёбер подряд
+    std::shared_ptr<const void> storage_; // Владелец памяти массивов: собственные массивы или отображённый файл
+
+    // Методы
+
+    // Подключение собственных массивов снимка
+    void attach(std::shared_ptr<Arrays> arrays);
+    // Проверка структуры массивов без чтения весов (выбрасывает std::runtime_error)
+    void checkStructure() const;
+    // Битовая карта существующих узлов для результата поиска путей
+    std::vector<bool> presentNodes() const;
+};
+#endif
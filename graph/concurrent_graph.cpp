@@ -0,0 +1,192 @@
+#include "concurrent_graph.h"
+#include <algorithm>
+#include <functional>
+#include <thread>
+
+// Конструктор с параметром
+ConcurrentGraph::ConcurrentGraph(size_t size):
+    ConcurrentGraph(DirectedGraph(size))
+{}
+
+// Конструктор из существующего графа
+ConcurrentGraph::ConcurrentGraph(const DirectedGraph& graph):
+    current_(new DirectedGraph(graph)),
+    epoch_(0),
+    slotCount_(std::max<size_t>(64, 2 * std::thread::hardware_concurrency())),
+    slots_(new ReaderSlot[slotCount_])
+{}
+
+// Деструктор
+ConcurrentGraph::~ConcurrentGraph()
+{
+    for (const Retired& retired : retired_)
+    {
+        delete retired.graph;
+    }
+    delete current_.load();
+}
+
+// Получение снимка текущей версии графа
+DirectedGraph ConcurrentGraph::snapshot() const
+{
+    ReadGuard guard(*this);
+    return guard.graph();
+}
+
+// Получение количества элементов в графе
+size_t ConcurrentGraph::size() const
+{
+    ReadGuard guard(*this);
+    return guard.graph().size();
+}
+
+// Получение версии графа
+size_t ConcurrentGraph::version() const
+{
+    ReadGuard guard(*this);
+    return guard.graph().version();
+}
+
+// Проверка наличия узла в графе
+bool ConcurrentGraph::searchNode(size_t key) const
+{
+    ReadGuard guard(*this);
+    return guard.graph().searchNode(key);
+}
+
+// Проверка наличия ребра между заданными узлами графа
+bool ConcurrentGraph::hasVertex(size_t origin, size_t destination) const
+{
+    ReadGuard guard(*this);
+    return guard.graph().hasVertex(origin, destination);
+}
+
+// Алгоритм Дейкстры для поиска кратчайших путей
+std::unordered_map<size_t, double> ConcurrentGraph::dijkstra(size_t origin) const
+{
+    ReadGuard guard(*this);
+    return guard.graph().dijkstra(origin);
+}
+
+// Алгоритм Дейкстры для одной пары узлов
+double ConcurrentGraph::shortestPath(size_t origin, size_t destination) const
+{
+    ReadGuard guard(*this);
+    return guard.graph().shortestPath(origin, destination);
+}
+
+// Добавление узла в граф
+void ConcurrentGraph::insertNode(size_t key)
+{
+    update([key](DirectedGraph& graph) { graph.insertNode(key); });
+}
+
+// Удаление узла из графа
+void ConcurrentGraph::removeNode(size_t key)
+{
+    update([key](DirectedGraph& graph) { graph.removeNode(key); });
+}
+
+// Добавление ребра между узлами
+void ConcurrentGraph::addVertex(size_t origin, double weight, size_t destination)
+{
+    update([&](DirectedGraph& graph) { graph.addVertex(origin, weight, destination); });
+}
+
+// Удаление ребра между заданными узлами графа
+double ConcurrentGraph::removeVertex(size_t origin, size_t destination)
+{
+    return update([&](DirectedGraph& graph) { return graph.removeVertex(origin, destination); });
+}
+
+// Занятие свободной ячейки читателя
+size_t ConcurrentGraph::enter() const
+{
+    // Поток начинает с «своей» ячейки, поэтому при числе потоков меньше числа ячеек столкновений почти нет
+    static thread_local size_t hint = std::hash<std::thread::id>()(std::this_thread::get_id());
+    for (;;)
+    {
+        for (size_t i = 0; i < slotCount_; ++i)
+        {
+            size_t slot = (hint + i) % slotCount_;
+            uint64_t expected = idle;
+            if (slots_[slot].epoch.load(std::memory_order_relaxed) != idle) continue;
+            if (slots_[slot].epoch.compare_exchange_strong(expected, epoch_.load(), std::memory_order_seq_cst))
+            {
+                hint = slot;
+                return slot;
+            }
+        }
+        std::this_thread::yield(); // Все ячейки заняты: ждём, пока какой-нибудь читатель завершится
+    }
+}
+
+// Освобождение ячейки читателя
+void ConcurrentGraph::leave(size_t slot) const
+{
+    uint64_t epoch = slots_[slot].epoch.load(std::memory_order_relaxed);
+    slots_[slot].epoch.store(idle, std::memory_order_seq_cst);
+
+    // Читатель эпохи позже последней замены не мешал освобождению ни одной версии. Иначе он мог быть
+    // последним, кто их видел: писатель, поставивший версию в очередь после этой проверки, увидит
+    // свободную ячейку сам (обе стороны сначала пишут, затем читают с seq_cst)
+    if (retiredCount_.load(std::memory_order_seq_cst) != 0 && epoch <= newestRetired_.load()) reclaim();
+}
+
+// Публикация новой версии
+void ConcurrentGraph::publish(DirectedGraph&& next)
+{
+    // После публикации добавление в список не должно выбрасывать исключений
+    {
+        // Читатели могут только укоротить список, поэтому запаса хватит и к моменту добавления
+        std::lock_guard<std::mutex> lock(retiredMutex_);
+        if (retired_.size() == retired_.capacity()) retired_.reserve(2 * retired_.size() + 1);
+    }
+    auto published = std::make_unique<DirectedGraph>(std::move(next));
+
+    // Читатель, отметивший эпоху позже fetch_add, прочитает уже новый указатель
+    const DirectedGraph* previous = current_.exchange(published.release());
+    uint64_t epoch = epoch_.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(retiredMutex_);
+        retired_.push_back({previous, epoch});
+        newestRetired_.store(epoch);
+        retiredCount_.store(retired_.size(), std::memory_order_seq_cst);
+    }
+    reclaim();
+}
+
+// Освобождение прежних версий
+void ConcurrentGraph::reclaim() const
+{
+    // Вызывается и из деструктора ReadGuard, поэтому не выделяет память
+    std::lock_guard<std::mutex> lock(retiredMutex_);
+    uint64_t oldest = idle;
+    for (size_t i = 0; i < slotCount_; ++i)
+    {
+        oldest = std::min(oldest, slots_[i].epoch.load());
+    }
+
+    auto end = std::partition(retired_.begin(), retired_.end(), [oldest](const Retired& retired)
+    {
+        return retired.epoch >= oldest;
+    });
+    for (auto it = end; it != retired_.end(); ++it)
+    {
+        delete it->graph;
+    }
+    retired_.erase(end, retired_.end());
+    retiredCount_.store(retired_.size(), std::memory_order_seq_cst);
+}
+
+// Освобождение прежних версий по запросу
+void ConcurrentGraph::collect()
+{
+    reclaim();
+}
+
+// Количество прежних версий, ожидающих освобождения
+size_t ConcurrentGraph::retiredVersions() const
+{
+    return retiredCount_.load();
+}
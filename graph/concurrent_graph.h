@@ -0,0 +1,181 @@
+#ifndef CONCURRENTGRAPH_H
+#define CONCURRENTGRAPH_H
+
+#include "directed_graph.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <type_traits>
+#include <unordered_map>
+#include <cstdint>
+
+// Граф для одновременного чтения и изменения из разных потоков (RCU).
+// Читатели работают с опубликованной версией графа без блокировок: поток отмечает эпоху в своей ячейке
+// и читает текущий указатель. Писатель изменяет копию опубликованной версии (копия — снимок за O(1),
+// копируются только затронутые блоки узлов), публикует её атомарной заменой указателя, а прежнюю
+// версию освобождает, когда все читатели покинут эпохи, в которых могли её видеть. Освобождение не ждёт
+// следующей записи: последний читатель, который мог видеть прежние версии, освобождает их при выходе.
+// Изменения выполняются по одному под общей блокировкой записи: каждое публикует согласованную версию.
+// Публикация копирует таблицу групп (V / 4096 указателей), а затронутые группы и блоки — при первом изменении
+// каждого из них (64 указателя и списки рёбер 64 узлов). Поэтому отдельная запись стоит десятки микросекунд,
+// и несколько изменений выгоднее выполнять одним вызовом update: блоки копируются один раз за пакет
+class ConcurrentGraph
+{
+public:
+    // Конструктор с параметром: вместимость пустого графа
+    explicit ConcurrentGraph(size_t size = 5);
+    // Конструктор из существующего графа (граф копируется за O(1))
+    explicit ConcurrentGraph(const DirectedGraph& graph);
+
+    // Граф нельзя копировать и перемещать: читатели ссылаются на его состояние
+    ConcurrentGraph(const ConcurrentGraph&) = delete;
+    ConcurrentGraph& operator=(const ConcurrentGraph&) = delete;
+
+    // Деструктор (к моменту удаления не должно быть читателей и писателей)
+    ~ConcurrentGraph();
+
+    // Методы чтения (без блокировок, можно вызывать из любого числа потоков)
+
+    // Вызов reader(const DirectedGraph&) для текущей версии графа; возвращает результат reader.
+    // Версия не меняется до выхода из reader, ссылку на граф нельзя сохранять после выхода
+    template <class Reader>
+    auto read(Reader&& reader) const;
+    // Получение снимка текущей версии графа за O(1); снимок не меняется при последующих изменениях
+    DirectedGraph snapshot() const;
+
+    // Получение количества элементов в графе
+    size_t size() const;
+    // Получение версии графа (совпадает с DirectedGraph::version() опубликованной версии)
+    size_t version() const;
+    // Проверка наличия узла в графе
+    bool searchNode(size_t key) const;
+    // Проверка наличия ребра между заданными узлами графа
+    bool hasVertex(size_t origin, size_t destination) const;
+    // Алгоритм Дейкстры для поиска кратчайших путей
+    std::unordered_map<size_t, double> dijkstra(size_t origin) const;
+    // Алгоритм Дейкстры для одной пары узлов
+    double shortestPath(size_t origin, size_t destination) const;
+
+    // Методы изменения (исключения DirectedGraph пробрасываются, граф при этом не меняется).
+    // Одиночные методы публикуют версию на каждое изменение; для пакетов изменений используйте update
+
+    // Освобождение прежних версий, которые больше никто не читает (обычно не требуется: версии освобождают
+    // писатели и выходящие читатели)
+    void collect();
+    // Количество прежних версий, ожидающих освобождения
+    size_t retiredVersions() const;
+
+    // Вызов writer(DirectedGraph&) для копии текущей версии и публикация копии; возвращает результат writer.
+    // Все изменения внутри writer становятся видны читателям одновременно
+    template <class Writer>
+    auto update(Writer&& writer);
+
+    // Добавление узла в граф
+    void insertNode(size_t key);
+    // Удаление узла из графа
+    void removeNode(size_t key);
+    // Добавление ребра между узлами
+    void addVertex(size_t origin, double weight, size_t destination);
+    // Удаление ребра между заданными узлами графа
+    double removeVertex(size_t origin, size_t destination);
+
+private:
+    // Эпоха свободной ячейки читателя
+    static constexpr uint64_t idle = UINT64_MAX;
+
+    // Ячейка читателя: эпоха, в которой он начал чтение (своя строка кэша, чтобы читатели не мешали друг другу)
+    struct alignas(64) ReaderSlot
+    {
+        std::atomic<uint64_t> epoch{idle};
+    };
+
+    // Версия графа, ожидающая освобождения
+    struct Retired
+    {
+        const DirectedGraph* graph; // Прежняя версия
+        uint64_t epoch; // Эпоха замены: версию могли видеть только читатели эпох не позже этой
+    };
+
+    // Чтение текущей версии на время жизни объекта
+    class ReadGuard
+    {
+    public:
+        explicit ReadGuard(const ConcurrentGraph& owner):
+            owner_(owner),
+            slot_(owner.enter()),
+            graph_(owner.current_.load(std::memory_order_seq_cst))
+        {}
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        ~ReadGuard()
+        {
+            owner_.leave(slot_);
+        }
+
+        const DirectedGraph& graph() const
+        {
+            return *graph_;
+        }
+
+    private:
+        const ConcurrentGraph& owner_;
+        size_t slot_;
+        const DirectedGraph* graph_;
+    };
+
+    std::atomic<const DirectedGraph*> current_; // Опубликованная версия графа
+    std::atomic<uint64_t> epoch_; // Текущая эпоха (увеличивается при каждой публикации)
+    size_t slotCount_; // Количество ячеек читателей
+    std::unique_ptr<ReaderSlot[]> slots_; // Ячейки читателей
+    std::mutex writeMutex_; // Блокировка записи
+    // Защита списка прежних версий: не держится во время изменений, поэтому читатель при выходе
+    // не ждёт писателя, выполняющего writer
+    mutable std::mutex retiredMutex_;
+    mutable std::vector<Retired> retired_; // Прежние версии, которые ещё могут читать (защищены retiredMutex_)
+    mutable std::atomic<size_t> retiredCount_{0}; // Размер retired_ для проверки без блокировки
+    std::atomic<uint64_t> newestRetired_{0}; // Эпоха последней замены версии
+
+    // Методы
+
+    // Занятие свободной ячейки с отметкой текущей эпохи; возвращает номер ячейки
+    size_t enter() const;
+    // Освобождение ячейки читателя; читатель, который мог видеть прежние версии, освобождает их
+    void leave(size_t slot) const;
+    // Публикация новой версии и освобождение прежних, которые больше никто не читает (под writeMutex_)
+    void publish(DirectedGraph&& next);
+    // Освобождение прежних версий, эпохи которых раньше эпох всех активных читателей
+    void reclaim() const;
+};
+
+// Шаблонные методы
+
+template <class Reader>
+auto ConcurrentGraph::read(Reader&& reader) const
+{
+    ReadGuard guard(*this);
+    return reader(guard.graph());
+}
+
+template <class Writer>
+auto ConcurrentGraph::update(Writer&& writer)
+{
+    std::lock_guard<std::mutex> lock(writeMutex_);
+
+    // Указатель меняет только писатель, поэтому версию можно читать без отметки эпохи
+    DirectedGraph next(*current_.load(std::memory_order_relaxed));
+    if constexpr (std::is_void_v<decltype(writer(next))>)
+    {
+        writer(next);
+        publish(std::move(next));
+    }
+    else
+    {
+        auto result = writer(next);
+        publish(std::move(next));
+        return result;
+    }
+}
+#endif
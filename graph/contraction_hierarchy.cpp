@@ -0,0 +1,497 @@
+#include "contraction_hierarchy.h"
+#include "search_state.h"
+#include <queue>
+#include <limits>
+#include <algorithm>
+#include <stdexcept>
+#include <fstream>
+#include <cstring>
+
+static_assert(sizeof(size_t) == sizeof(uint64_t) && sizeof(double) == sizeof(uint64_t), "Index file stores 64-bit arrays as is");
+
+namespace
+{
+    // Номер отсутствующего узла
+    constexpr size_t noIndex = std::numeric_limits<size_t>::max();
+    // Наибольшее число дуг, просматриваемых поиском свидетелей при сжатии и при оценке приоритета.
+    // Если путь в обход сжимаемого узла не найден за это число шагов, добавляется сокращение:
+    // лишнее сокращение не влияет на точность запросов
+    constexpr size_t contractScanLimit = 2000;
+    constexpr size_t estimateScanLimit = 200;
+    // Сжатие останавливается, когда средняя степень оставшихся узлов превышает этот порог: в плотном ядре
+    // число сокращений растёт квадратично. Ядро остаётся несжатым, и запрос проходит его обычным поиском
+    constexpr size_t coreDegree = 12;
+    // Узел с большим числом пар входящих и исходящих дуг (концентратор) не сжимается и остаётся в ядре
+    constexpr size_t coreCandidates = 4096;
+    // Приоритет узлов, оставляемых в ядре
+    constexpr int64_t corePriority = std::numeric_limits<int64_t>::max();
+    // Признак порядка байт записавшей машины
+    constexpr uint32_t byteOrderMark = 0x01020304;
+
+    // Заголовок файла индекса (за ним следуют номера узлов и массивы прямого и обратного графов)
+    struct FileHeader
+    {
+        char magic[8]; // Сигнатура формата
+        uint32_t version; // Версия формата
+        uint32_t byteOrder; // byteOrderMark в порядке байт записавшей машины
+        uint64_t nodeCount; // Количество узлов
+        uint64_t forwardCount; // Количество рёбер прямого графа
+        uint64_t backwardCount; // Количество рёбер обратного графа
+        uint64_t shortcutCount; // Количество рёбер-сокращений
+        uint64_t reserved[2]; // Зарезервировано (нули)
+    };
+    static_assert(sizeof(FileHeader) == 64, "Index header must occupy 64 bytes");
+
+    constexpr char fileMagic[8] = {'T', 'P', 'C', 'H', 'I', 'D', 'X', '\0'};
+
+    // Дуга графа, который сжимается
+    struct Arc
+    {
+        size_t node; // Соседний узел
+        double weight; // Вес дуги
+    };
+
+    // Ребро-сокращение
+    struct Shortcut
+    {
+        size_t origin;
+        size_t destination;
+        double weight;
+    };
+
+    // Добавление дуги или уменьшение веса существующей (true, если дуга добавлена)
+    bool mergeArc(std::vector<Arc>& arcs, size_t node, double weight)
+    {
+        for (auto& arc : arcs)
+        {
+            if (arc.node != node) continue;
+            arc.weight = std::min(arc.weight, weight);
+            return false;
+        }
+        arcs.push_back(Arc{node, weight});
+        return true;
+    }
+
+    // Удаление дуги к узлу (порядок дуг не важен)
+    void removeArc(std::vector<Arc>& arcs, size_t node)
+    {
+        for (size_t i = 0; i < arcs.size(); ++i)
+        {
+            if (arcs[i].node != node) continue;
+            arcs[i] = arcs.back();
+            arcs.pop_back();
+            return;
+        }
+    }
+
+    // Сжимаемый граф: дуги между ещё не сжатыми узлами
+    class Contractor
+    {
+    public:
+        std::vector<std::vector<Arc>> out; // Исходящие дуги
+        std::vector<std::vector<Arc>> in; // Входящие дуги (node — узел источника)
+
+        size_t arcCount; // Количество дуг между несжатыми узлами
+
+        explicit Contractor(size_t count):
+            out(count),
+            in(count),
+            arcCount(0),
+            deletedNeighbors_(count, 0),
+            targetRounds_(count, 0),
+            round_(0)
+        {}
+
+        // Добавление дуги исходного графа
+        void addArc(size_t origin, double weight, size_t destination)
+        {
+            if (mergeArc(out[origin], destination, weight))
+            {
+                in[destination].push_back(Arc{origin, weight});
+                arcCount++;
+                return;
+            }
+            mergeArc(in[destination], origin, weight);
+        }
+
+        // Сокращения, которые потребуются при сжатии узла
+        void findShortcuts(size_t node, std::vector<Shortcut>& shortcuts, size_t scanLimit)
+        {
+            shortcuts.clear();
+            round_++;
+            for (const Arc& outgoing : out[node])
+            {
+                targetRounds_[outgoing.node] = round_;
+            }
+
+            for (const Arc& incoming : in[node])
+            {
+                // Поиск свидетелей ограничен самым длинным путём через узел
+                double limit = -1.0;
+                for (const Arc& outgoing : out[node])
+                {
+                    if (outgoing.node != incoming.node) limit = std::max(limit, incoming.weight + outgoing.weight);
+                }
+                if (limit < 0) continue;
+                size_t targets = out[node].size() - ((targetRounds_[incoming.node] == round_) ? 1 : 0);
+                witnessSearch(incoming.node, node, limit, targets, scanLimit);
+
+                for (const Arc& outgoing : out[node])
+                {
+                    if (outgoing.node == incoming.node) continue;
+                    double through = incoming.weight + outgoing.weight;
+                    if (state_.distance(outgoing.node) > through) shortcuts.push_back(Shortcut{incoming.node, outgoing.node, through});
+                }
+            }
+        }
+
+        // Приоритет узла (меньше — сжимается раньше): разность рёбер плюс число уже сжатых соседей
+        int64_t priority(size_t node, std::vector<Shortcut>& shortcuts)
+        {
+            if (in[node].size() * out[node].size() > coreCandidates) return corePriority;
+            findShortcuts(node, shortcuts, estimateScanLimit);
+            return static_cast<int64_t>(shortcuts.size()) - static_cast<int64_t>(in[node].size() + out[node].size()) + deletedNeighbors_[node];
+        }
+
+        // Сжатие узла: удаление его дуг и добавление найденных для него сокращений
+        void contract(size_t node, const std::vector<Shortcut>& shortcuts)
+        {
+            for (const Arc& incoming : in[node])
+            {
+                removeArc(out[incoming.node], node);
+                deletedNeighbors_[incoming.node]++;
+            }
+            for (const Arc& outgoing : out[node])
+            {
+                removeArc(in[outgoing.node], node);
+                deletedNeighbors_[outgoing.node]++;
+            }
+            arcCount -= in[node].size() + out[node].size();
+            out[node].clear();
+            in[node].clear();
+
+            for (const auto& shortcut : shortcuts)
+            {
+                addArc(shortcut.origin, shortcut.weight, shortcut.destination);
+            }
+        }
+
+    private:
+        std::vector<int64_t> deletedNeighbors_; // Количество сжатых соседей узла
+        SearchState state_; // Состояние поиска свидетелей
+        std::vector<size_t> targetRounds_; // Номер вызова findShortcuts, для которого узел — сосед по исходящей дуге
+        size_t round_; // Номер текущего вызова findShortcuts
+
+        // Поиск Дейкстры от source по несжатым узлам в обход excluded до расстояния limit
+        // или до извлечения всех targets соседей excluded по исходящим дугам.
+        // Найденные расстояния (даже не окончательные) — длины существующих путей-свидетелей
+        void witnessSearch(size_t source, size_t excluded, double limit, size_t targets, size_t scanLimit)
+        {
+            state_.reset(out.size());
+            state_.setDistance(source, 0.0);
+            state_.queue.push(0.0, source);
+
+            size_t scanned = 0;
+            while (!state_.queue.empty() && scanned < scanLimit)
+            {
+                auto [currentDist, currentNode] = state_.queue.pop();
+                if (currentDist > state_.distance(currentNode)) continue;
+                if (currentDist > limit) break;
+                if (targetRounds_[currentNode] == round_ && currentNode != source && --targets == 0) break;
+
+                scanned += out[currentNode].size();
+                for (const Arc& arc : out[currentNode])
+                {
+                    if (arc.node == excluded) continue;
+                    double newDist = currentDist + arc.weight;
+                    if (newDist < state_.distance(arc.node))
+                    {
+                        state_.setDistance(arc.node, newDist);
+                        state_.queue.push(newDist, arc.node);
+                    }
+                }
+            }
+        }
+    };
+
+    // Запись массива в поток
+    template <class T>
+    void writeArray(std::ostream& out, const std::vector<T>& values)
+    {
+        out.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+    }
+
+    // Чтение массива заданной длины из потока
+    template <class T>
+    void readArray(std::istream& in, std::vector<T>& values, size_t count)
+    {
+        values.resize(count);
+        in.read(reinterpret_cast<char*>(values.data()), count * sizeof(T));
+    }
+}
+
+// Конструкторы
+
+ContractionHierarchy::ContractionHierarchy():
+    shortcutCount_(0)
+{}
+
+ContractionHierarchy::ContractionHierarchy(const DirectedGraph& graph):
+    shortcutCount_(0)
+{
+    graph.forEachNode([this](size_t key) { nodes_.push_back(key); });
+    indexNodes();
+    size_t count = nodes_.size();
+
+    // Исходный граф в номерах узлов индекса (петли не лежат на кратчайших путях)
+    Contractor contractor(count);
+    graph.forEachVertex([&](size_t origin, double weight, size_t destination)
+    {
+        if (weight < 0) throw std::logic_error("Contraction hierarchies require non-negative weights");
+        if (origin == destination) return;
+        contractor.addArc(indexes_[origin], weight, indexes_[destination]);
+    });
+
+    // Очередь узлов по приоритету с ленивым обновлением
+    using Entry = std::pair<int64_t, size_t>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> order;
+    std::vector<int64_t> priorities(count);
+    std::vector<bool> contracted(count, false);
+    std::vector<Shortcut> shortcuts;
+    for (size_t node = 0; node < count; ++node)
+    {
+        priorities[node] = contractor.priority(node, shortcuts);
+        order.emplace(priorities[node], node);
+    }
+
+    // Дуги узла в момент сжатия ведут к более важным узлам: они и образуют граф запросов
+    std::vector<std::vector<Arc>> forwardArcs(count);
+    std::vector<std::vector<Arc>> backwardArcs(count);
+    size_t remaining = count;
+    while (!order.empty() && contractor.arcCount <= coreDegree * remaining)
+    {
+        auto [priority, node] = order.top();
+        order.pop();
+        if (contracted[node] || priority != priorities[node]) continue; // Устаревшая запись
+
+        // Приоритет мог вырасти после сжатия других узлов: если узел уже не лучший, откладываем его
+        int64_t current = contractor.priority(node, shortcuts);
+        if (!order.empty() && current > order.top().first)
+        {
+            priorities[node] = current;
+            order.emplace(current, node);
+            continue;
+        }
+        if (current == corePriority) break; // Остались только узлы ядра
+
+        contractor.findShortcuts(node, shortcuts, contractScanLimit);
+        forwardArcs[node] = contractor.out[node];
+        backwardArcs[node] = contractor.in[node];
+        contractor.contract(node, shortcuts);
+        contracted[node] = true;
+        remaining--;
+        shortcutCount_ += shortcuts.size();
+    }
+
+    // Узлы ядра сохраняют все дуги между собой в обоих графах запросов
+    for (size_t node = 0; node < count; ++node)
+    {
+        if (contracted[node]) continue;
+        forwardArcs[node] = std::move(contractor.out[node]);
+        backwardArcs[node] = std::move(contractor.in[node]);
+    }
+
+    // Перевод графов запросов в CSR
+    auto compress = [count](const std::vector<std::vector<Arc>>& arcs, UpwardGraph& upward)
+    {
+        upward.offsets.assign(count + 1, 0);
+        for (size_t node = 0; node < count; ++node)
+        {
+            upward.offsets[node + 1] = upward.offsets[node] + arcs[node].size();
+        }
+        upward.targets.reserve(upward.offsets[count]);
+        upward.weights.reserve(upward.offsets[count]);
+        for (const auto& nodeArcs : arcs)
+        {
+            for (const Arc& arc : nodeArcs)
+            {
+                upward.targets.push_back(arc.node);
+                upward.weights.push_back(arc.weight);
+            }
+        }
+    };
+    compress(forwardArcs, forward_);
+    compress(backwardArcs, backward_);
+}
+
+// Приватные методы
+
+void ContractionHierarchy::indexNodes()
+{
+    indexes_.assign(nodes_.empty() ? 0 : nodes_.back() + 1, noIndex);
+    for (size_t index = 0; index < nodes_.size(); ++index)
+    {
+        indexes_[nodes_[index]] = index;
+    }
+}
+
+// Публичные методы
+
+size_t ContractionHierarchy::size() const
+{
+    return nodes_.size();
+}
+
+size_t ContractionHierarchy::shortcutCount() const
+{
+    return shortcutCount_;
+}
+
+bool ContractionHierarchy::contains(size_t key) const
+{
+    return (key < indexes_.size()) && (indexes_[key] != noIndex);
+}
+
+double ContractionHierarchy::shortestPath(size_t origin, size_t destination, size_t* settledNodes) const
+{
+    if (contains(origin) == false) throw std::invalid_argument("Origin node does not exist"); // Проверка на существование исходного узла
+    if (contains(destination) == false) throw std::invalid_argument("Destination node does not exist"); // Проверка на существование узла назначения
+
+    const double infinity = std::numeric_limits<double>::infinity();
+    SearchState* states[2] = {&searchState(0), &searchState(1)};
+    const UpwardGraph* graphs[2] = {&forward_, &backward_};
+    size_t sources[2] = {indexes_[origin], indexes_[destination]};
+    for (size_t side = 0; side < 2; ++side)
+    {
+        states[side]->reset(nodes_.size());
+        states[side]->setDistance(sources[side], 0.0);
+        states[side]->queue.push(0.0, sources[side]);
+    }
+
+    // Поиски идут по очереди; направление останавливается, когда его минимум не меньше лучшего пути
+    double best = infinity;
+    size_t settled = 0;
+    bool active[2] = {true, true};
+    for (size_t side = 0; active[0] || active[1]; side = 1 - side)
+    {
+        if (!active[side]) continue;
+        SearchState& state = *states[side];
+        if (state.queue.empty())
+        {
+            active[side] = false;
+            continue;
+        }
+
+        auto [currentDist, currentNode] = state.queue.pop();
+        if (currentDist > state.distance(currentNode)) continue; // Устаревшая пара из очереди
+        if (currentDist >= best)
+        {
+            active[side] = false;
+            continue;
+        }
+        settled++;
+
+        // Узел достигнут встречным поиском: путь через него — кандидат
+        best = std::min(best, currentDist + states[1 - side]->distance(currentNode));
+
+        const UpwardGraph& upward = *graphs[side];
+        for (size_t edge = upward.offsets[currentNode]; edge < upward.offsets[currentNode + 1]; ++edge)
+        {
+            double newDist = currentDist + upward.weights[edge];
+            if (newDist < state.distance(upward.targets[edge]))
+            {
+                state.setDistance(upward.targets[edge], newDist);
+                state.queue.push(newDist, upward.targets[edge]);
+            }
+        }
+    }
+
+    if (settledNodes != nullptr) *settledNodes = settled;
+    return best;
+}
+
+void ContractionHierarchy::save(const std::string& fileName) const
+{
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) throw std::runtime_error("Failed to open file");
+
+    FileHeader header{};
+    std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.version = formatVersion;
+    header.byteOrder = byteOrderMark;
+    header.nodeCount = nodes_.size();
+    header.forwardCount = forward_.targets.size();
+    header.backwardCount = backward_.targets.size();
+    header.shortcutCount = shortcutCount_;
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeArray(file, nodes_);
+    for (const UpwardGraph* upward : {&forward_, &backward_})
+    {
+        writeArray(file, upward->offsets);
+        writeArray(file, upward->targets);
+        writeArray(file, upward->weights);
+    }
+
+    file.flush();
+    if (!file) throw std::runtime_error("Failed to write file");
+}
+
+ContractionHierarchy ContractionHierarchy::load(const std::string& fileName)
+{
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file.is_open()) throw std::runtime_error("Failed to open file");
+
+    // Проверка заголовка
+    FileHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) throw std::runtime_error("Index file is truncated");
+    if (std::memcmp(header.magic, fileMagic, sizeof(fileMagic)) != 0) throw std::runtime_error("File is not a contraction hierarchy index");
+    if (header.version != formatVersion) throw std::runtime_error("Unsupported index format version");
+    if (header.byteOrder != byteOrderMark) throw std::runtime_error("Index was written with a different byte order");
+
+    // Размеры массивов проверяются по размеру файла до выделения памяти
+    file.seekg(0, std::ios::end);
+    uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+    file.seekg(sizeof(header));
+    uint64_t words = (fileSize - sizeof(header)) / sizeof(uint64_t);
+    if (header.nodeCount > words || header.forwardCount > words || header.backwardCount > words ||
+        sizeof(header) + (3 * header.nodeCount + 2 + 2 * header.forwardCount + 2 * header.backwardCount) * sizeof(uint64_t) != fileSize)
+    {
+        throw std::runtime_error("Index file is truncated");
+    }
+
+    ContractionHierarchy hierarchy;
+    hierarchy.shortcutCount_ = header.shortcutCount;
+    readArray(file, hierarchy.nodes_, header.nodeCount);
+    uint64_t counts[2] = {header.forwardCount, header.backwardCount};
+    UpwardGraph* graphs[2] = {&hierarchy.forward_, &hierarchy.backward_};
+    for (size_t side = 0; side < 2; ++side)
+    {
+        readArray(file, graphs[side]->offsets, header.nodeCount + 1);
+        readArray(file, graphs[side]->targets, counts[side]);
+        readArray(file, graphs[side]->weights, counts[side]);
+    }
+    if (!file) throw std::runtime_error("Index file is truncated");
+
+    // Проверка согласованности массивов
+    for (size_t index = 1; index < hierarchy.nodes_.size(); ++index)
+    {
+        if (hierarchy.nodes_[index - 1] >= hierarchy.nodes_[index]) throw std::runtime_error("Index file is corrupted");
+    }
+    for (size_t side = 0; side < 2; ++side)
+    {
+        const UpwardGraph& upward = *graphs[side];
+        if (upward.offsets.front() != 0 || upward.offsets.back() != counts[side]) throw std::runtime_error("Index file is corrupted");
+        for (size_t index = 0; index < header.nodeCount; ++index)
+        {
+            if (upward.offsets[index] > upward.offsets[index + 1]) throw std::runtime_error("Index file is corrupted");
+        }
+        for (size_t target : upward.targets)
+        {
+            if (target >= header.nodeCount) throw std::runtime_error("Index file is corrupted");
+        }
+    }
+
+    hierarchy.indexNodes();
+    return hierarchy;
+}
@@ -0,0 +1,69 @@
+#ifndef CONTRACTIONHIERARCHY_H
+#define CONTRACTIONHIERARCHY_H
+
+#include "directed_graph.h"
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+// Иерархия сжатия (Contraction Hierarchies) для быстрых запросов к неизменяемому графу.
+// Узлы сжимаются по одному в порядке важности; если кратчайший путь между соседями сжимаемого узла
+// проходит через него, добавляется ребро-сокращение. Запрос — двунаправленный поиск Дейкстры
+// только по рёбрам к более важным узлам, поэтому он просматривает малую часть графа.
+// Плотное ядро (на графах без иерархии, например случайных) и концентраторы не сжимаются:
+// внутри ядра запрос идёт обычным двунаправленным поиском, и расстояния остаются точными.
+// Индекс — снимок графа на момент построения: после изменения графа его нужно построить заново
+class ContractionHierarchy
+{
+public:
+    // Версия двоичного формата файла индекса
+    static constexpr uint32_t formatVersion = 1;
+
+    // Построение индекса (предобработка может быть долгой).
+    // Выбрасывает std::logic_error, если в графе есть рёбра отрицательного веса
+    explicit ContractionHierarchy(const DirectedGraph& graph);
+
+    // Методы
+
+    // Получение количества узлов
+    size_t size() const;
+    // Получение количества добавленных рёбер-сокращений
+    size_t shortcutCount() const;
+    // Проверка, существовал ли узел в графе на момент построения
+    bool contains(size_t key) const;
+
+    // Кратчайшее расстояние между узлами (бесконечность, если путь не существует).
+    // Число извлечённых из очередей узлов записывается в settledNodes, если он передан
+    double shortestPath(size_t origin, size_t destination, size_t* settledNodes = nullptr) const;
+
+    // Запись индекса в двоичный файл. Выбрасывает std::runtime_error при ошибке записи
+    void save(const std::string& fileName) const;
+    // Чтение индекса из двоичного файла.
+    // Выбрасывает std::runtime_error, если файл не удалось открыть или он повреждён
+    static ContractionHierarchy load(const std::string& fileName);
+
+private:
+    // Рёбра к более важным узлам в формате CSR (узлы — номера в порядке nodes_)
+    struct UpwardGraph
+    {
+        std::vector<size_t> offsets; // Начало рёбер каждого узла (размер: число узлов + 1)
+        std::vector<size_t> targets; // Узлы назначения рёбер подряд
+        std::vector<double> weights; // Веса рёбер подряд
+    };
+
+    std::vector<size_t> nodes_; // Номера узлов графа по возрастанию
+    std::vector<size_t> indexes_; // Номер узла в nodes_ по номеру узла графа (noIndex для отсутствующих)
+    UpwardGraph forward_; // Исходящие рёбра к более важным узлам (поиск от исходного узла)
+    UpwardGraph backward_; // Входящие рёбра от более важных узлов (поиск от узла назначения)
+    size_t shortcutCount_; // Количество рёбер-сокращений
+
+    // Конструктор по умолчанию (для чтения из файла)
+    ContractionHierarchy();
+
+    // Методы
+
+    // Построение indexes_ по nodes_
+    void indexNodes();
+};
+#endif
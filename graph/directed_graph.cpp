@@ -1,28 +1,70 @@
 #include "directed_graph.h"
 #include <queue>
 #include <limits>
+#include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include "thread_pool.h"
+#include "search_state.h"
 
-// Приватные методы
+const std::optional<DirectedGraph::VertexList> DirectedGraph::absent_;
+
+// Конструкторы
 
-DirectedGraph::Vertex *DirectedGraph::searchVertex(size_t origin, size_t destination) const
+DirectedGraph::DirectedGraph(const CompressedGraph& snapshot):
+    size_(snapshot.capacity_),
+    realSize_(snapshot.realSize_),
+    vertexCount_(snapshot.vertexCount_),
+    nonPositiveVertexes_(0),
+    version_(nextVersion()),
+    pool_(std::make_shared<std::pmr::synchronized_pool_resource>()),
+    chunks_(std::make_shared<ChunkTable>(groupCount(size_)))
 {
-    if (searchNode(origin) == false) throw std::invalid_argument("Origin node is not in the graph"); // Проверяем наличие узла источника
-    if (searchNode(destination) == false) throw std::invalid_argument("Destination node is not in the graph"); // Проверяем наличие узла назначения
 
-    // Получаем указатель на список ребер
-    const auto& vertexes = adjacencyList_.at(origin);
+    // Считаем входящие степени, чтобы выделить обратные списки одним блоком
+    std::vector<size_t> inDegrees(size_, 0);
+    for (size_t i = 0; i < snapshot.vertexCount_; ++i)
+    {
+        inDegrees[snapshot.destinations_[i]]++;
+    }
+
+    for (size_t key = 0; key < size_; ++key)
+    {
+        if (!snapshot.searchNode(key)) continue;
+
+        createLists(key);
+        mutableOutgoing(key).reserve(snapshot.offsets_[key + 1] - snapshot.offsets_[key]);
+        mutableIncoming(key).reserve(inDegrees[key]);
+    }
 
-    // Ищем ребро в списке
-    for (auto& vertex : *vertexes) 
+    // Рёбра снимка уже прошли проверки addVertex, поэтому добавляются без них
+    for (size_t origin = 0; origin < size_; ++origin)
     {
-        if (vertex.destination_ == destination) 
+        for (size_t i = snapshot.offsets_[origin]; i < snapshot.offsets_[origin + 1]; ++i)
         {
-            // Возвращаем указатель на найденную вершину
-            return &vertex;
+            mutableOutgoing(origin).insert(Vertex{snapshot.weights_[i], snapshot.destinations_[i]});
+            mutableIncoming(snapshot.destinations_[i]).insert(Vertex{snapshot.weights_[i], origin});
+            if (snapshot.weights_[i] <= 0) nonPositiveVertexes_++;
         }
     }
+}
 
-    return nullptr;
+// Приватные методы
+
+size_t DirectedGraph::nextVersion()
+{
+    static std::atomic<size_t> counter(0); // Последняя выданная версия (общая для всех графов)
+    return ++counter;
+}
+
+const DirectedGraph::Vertex* DirectedGraph::searchVertex(size_t origin, size_t destination) const
+{
+    if (searchNode(origin) == false) throw std::invalid_argument("Origin node is not in the graph"); // Проверяем наличие узла источника
+    if (searchNode(destination) == false) throw std::invalid_argument("Destination node is not in the graph"); // Проверяем наличие узла назначения
+
+    // Ищем ребро в списке узла источника
+    return outgoing(origin)->find(destination);
 }
 
 size_t DirectedGraph::size() const
@@ -32,44 +74,74 @@ size_t DirectedGraph::size() const
 
 bool DirectedGraph::isOnlyPositiveVertexes() const
 {
-    // Перебираем каждый узел в графе
-    for (const auto& node: adjacencyList_)
+    return nonPositiveVertexes_ == 0;
+}
+
+DirectedGraph::Chunk::Chunk(std::shared_ptr<std::pmr::synchronized_pool_resource> listPool):
+    pool(std::move(listPool))
+{}
+
+DirectedGraph::Chunk::Chunk(const Chunk& other):
+    pool(other.pool)
+{
+    for (size_t i = 0; i < chunkSize; ++i)
     {
-        if (node == nullptr) continue; // Если узел не существует, переходим к следующему
+        if (other.outgoing[i]) outgoing[i].emplace(*other.outgoing[i], pool.get());
+        if (other.incoming[i]) incoming[i].emplace(*other.incoming[i], pool.get());
+    }
+}
 
-        for (const auto& vertex : *node.get()) 
-        {
-           if (vertex.weight_ <= 0) return false;
-        }
+namespace
+{
+    // Проверка, что объект больше никем не разделяется. Другие владельцы освобождают ссылки
+    // с барьером release, поэтому после барьера acquire их чтения объекта завершены
+    template <class T>
+    bool isExclusive(const std::shared_ptr<T>& pointer)
+    {
+        if (pointer.use_count() != 1) return false;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
     }
-    return true;
+}
+
+DirectedGraph::Chunk& DirectedGraph::ownChunk(size_t key)
+{
+    if (!isExclusive(chunks_)) chunks_ = std::make_shared<ChunkTable>(*chunks_);
+
+    auto& group = (*chunks_)[key >> groupShift];
+    if (group == nullptr) group = std::make_shared<ChunkGroup>();
+    else if (!isExclusive(group)) group = std::make_shared<ChunkGroup>(*group);
+
+    auto& chunk = group->chunks[(key >> chunkBits) & (groupSize - 1)];
+    if (chunk == nullptr) chunk = std::make_shared<Chunk>(pool_);
+    else if (!isExclusive(chunk)) chunk = std::make_shared<Chunk>(*chunk);
+    return *chunk;
+}
+
+void DirectedGraph::growChunks()
+{
+    if (chunks_ == nullptr) chunks_ = std::make_shared<ChunkTable>();
+    else if (!isExclusive(chunks_)) chunks_ = std::make_shared<ChunkTable>(*chunks_);
+    if (chunks_->size() < groupCount(size_)) chunks_->resize(groupCount(size_));
+}
+
+void DirectedGraph::createLists(size_t key)
+{
+    Chunk& chunk = ownChunk(key);
+    chunk.outgoing[key & (chunkSize - 1)].emplace(chunk.pool.get());
+    chunk.incoming[key & (chunkSize - 1)].emplace(chunk.pool.get());
 }
 
 // Публичные методы
 
 bool DirectedGraph::isEmpty() const
 {
-    for (const auto& node : adjacencyList_)
-    {
-        if (node != nullptr) return false;
-    }
-    return true;
+    return realSize_ == 0;
 }
 
 bool DirectedGraph::searchNode(size_t key) const
 {
-    try
-    {
-        if (adjacencyList_.at(key) != nullptr)
-        {
-            return true;
-        }
-        else return false;
-    }
-    catch(const std::out_of_range)
-    {
-        return false;
-    }
+    return (key < size_) && outgoing(key).has_value();
 }
 
 void DirectedGraph::insertNode(size_t key)
@@ -81,12 +153,13 @@ void DirectedGraph::insertNode(size_t key)
         if (key >= size_)
         {
             size_ = key + 1;
-            adjacencyList_.resize(size_);
+            growChunks();
         }
 
         // Добавляем узел
-        adjacencyList_.at(key) = std::make_unique<std::list<Vertex>>();
+        createLists(key);
         realSize_++;
+        version_ = nextVersion();
     }
     else throw std::runtime_error("This node already exists in the graph");
 }
@@ -96,45 +169,149 @@ void DirectedGraph::removeNode(size_t key)
     // Проверяем наличие узла
     if (searchNode(key) == false) throw std::invalid_argument("This node is not in the graph");
 
-    // Обходим весь список с узлами
-    for (size_t i = 0; i < size_; i++)
-    {   
-        // Получаем список рёбер
-        const auto& nodeVertexes = adjacencyList_.at(i);
+    // Блок узла становится собственным заранее, чтобы изменение соседей не заменило обходимые списки
+    Chunk& chunk = ownChunk(key);
+    auto& outgoingEdges = chunk.outgoing[key & (chunkSize - 1)];
+    auto& incomingEdges = chunk.incoming[key & (chunkSize - 1)];
 
-        // Удаляем узел
-        if (i == key)
-        {
-            if (nodeVertexes->size() != 0) nodeVertexes->clear();
-            adjacencyList_.at(i) = nullptr;
-            realSize_--;
-        }
-        
-        // Удаляем ребро от i-того узла до key
-        if ((adjacencyList_.at(i) != nullptr) && hasVertex(i, key))
-        {
-            removeVertex(i, key);
-        }
+    // Удаляем исходящие рёбра узла из обратных списков его соседей
+    for (const auto& vertex : *outgoingEdges)
+    {
+        vertexCount_--;
+        if (vertex.weight_ <= 0) nonPositiveVertexes_--;
+        if (vertex.destination_ == key) continue; // Петля исчезнет вместе с узлом
+        mutableIncoming(vertex.destination_).erase(key);
+    }
+
+    // Удаляем входящие рёбра узла из списков смежности их источников
+    for (const auto& source : *incomingEdges)
+    {
+        if (source.destination_ == key) continue; // Петля уже учтена среди исходящих рёбер
+        vertexCount_--;
+        if (source.weight_ <= 0) nonPositiveVertexes_--;
+        mutableOutgoing(source.destination_).erase(key);
     }
+
+    // Удаляем узел
+    outgoingEdges.reset();
+    incomingEdges.reset();
+    realSize_--;
+    version_ = nextVersion();
 }
 
 void DirectedGraph::addVertex(size_t origin, double weight, size_t destination)
 {
     if (searchNode(origin) == false) throw std::invalid_argument("Origin node is not in the graph"); // Проверяем наличие узла источника
     if (searchNode(destination) == false) throw std::invalid_argument("Destination node is not in the graph"); // Проверяем наличие узла назначения
-    if (hasVertex(destination, origin) == true) throw std::logic_error("There is already a vertex between these nodes"); // Проверяем не является ли новое ребро обратным
+    if (outgoing(destination)->find(origin) != nullptr) throw std::logic_error("There is already a vertex between these nodes"); // Проверяем не является ли новое ребро обратным
 
     // Если между двумя нодами уже есть ребро, обновляем вес
-    Vertex* temp = searchVertex(origin, destination);
+    Vertex* temp = mutableOutgoing(origin).find(destination);
     if (temp != nullptr)
     {
+        if (temp->weight_ <= 0) nonPositiveVertexes_--;
+        if (weight <= 0) nonPositiveVertexes_++;
         temp->weight_ = weight;
+        mutableIncoming(destination).find(origin)->weight_ = weight;
+        version_ = nextVersion();
         return;
     }
 
     // Если ребро ещё не встречалось, то добавляем его в список рёбер
-    auto& originVertexes = adjacencyList_.at(origin);
-    originVertexes->push_back(Vertex{weight, destination});
+    mutableOutgoing(origin).insert(Vertex{weight, destination});
+    mutableIncoming(destination).insert(Vertex{weight, origin});
+    vertexCount_++;
+    if (weight <= 0) nonPositiveVertexes_++;
+    version_ = nextVersion();
+}
+
+size_t DirectedGraph::addVertexes(const std::vector<VertexRecord>& vertexes, std::vector<size_t>* skippedIndexes)
+{
+    if (vertexes.empty()) return 0;
+
+    // Расширяем граф один раз под наибольший номер узла
+    size_t maxKey = 0;
+    for (const auto& record : vertexes)
+    {
+        maxKey = std::max(maxKey, std::max(record.origin, record.destination));
+    }
+    if (maxKey >= size_)
+    {
+        size_ = maxKey + 1;
+        growChunks();
+    }
+
+    // Создание отсутствующего узла
+    auto createNode = [this](size_t key)
+    {
+        if (outgoing(key).has_value()) return;
+        createLists(key);
+        realSize_++;
+    };
+
+    if (vertexes.size() * 4 >= size_)
+    {
+        // Крупный пакет: считаем степени узлов, чтобы выделить память под их рёбра заранее
+        std::vector<size_t> outDegrees(size_, 0);
+        std::vector<size_t> inDegrees(size_, 0);
+        for (const auto& record : vertexes)
+        {
+            outDegrees[record.origin]++;
+            inDegrees[record.destination]++;
+        }
+
+        for (size_t key = 0; key < size_; ++key)
+        {
+            if (outDegrees[key] == 0 && inDegrees[key] == 0) continue;
+            createNode(key);
+            mutableOutgoing(key).reserve(outgoing(key)->size() + outDegrees[key]);
+            mutableIncoming(key).reserve(incoming(key)->size() + inDegrees[key]);
+        }
+    }
+    else
+    {
+        // Небольшой пакет в большом графе: проход по всем узлам дороже роста списков рёбер
+        for (const auto& record : vertexes)
+        {
+            createNode(record.origin);
+            createNode(record.destination);
+        }
+    }
+
+    // Добавляем рёбра по тем же правилам, что и addVertex
+    size_t skipped = 0;
+    for (size_t i = 0; i < vertexes.size(); ++i)
+    {
+        const auto& record = vertexes[i];
+        if (outgoing(record.destination)->find(record.origin) != nullptr)
+        {
+            if (skippedIndexes != nullptr) skippedIndexes->push_back(i);
+            skipped++;
+            continue;
+        }
+
+        Vertex* temp = mutableOutgoing(record.origin).find(record.destination);
+        if (temp != nullptr)
+        {
+            if (temp->weight_ <= 0) nonPositiveVertexes_--;
+            if (record.weight <= 0) nonPositiveVertexes_++;
+            temp->weight_ = record.weight;
+            mutableIncoming(record.destination).find(record.origin)->weight_ = record.weight;
+            continue;
+        }
+
+        mutableOutgoing(record.origin).insert(Vertex{record.weight, record.destination});
+        mutableIncoming(record.destination).insert(Vertex{record.weight, record.origin});
+        vertexCount_++;
+        if (record.weight <= 0) nonPositiveVertexes_++;
+    }
+    version_ = nextVersion();
+    return skipped;
+}
+
+size_t DirectedGraph::version() const
+{
+    return version_;
 }
 
 bool DirectedGraph::hasVertex(size_t origin, size_t destination) const
@@ -144,130 +321,524 @@ bool DirectedGraph::hasVertex(size_t origin, size_t destination) const
 
 double DirectedGraph::removeVertex(size_t origin, size_t destination)
 {
-    // Получаем указатель на список ребер
-    auto& originVertexes = adjacencyList_.at(origin);
-
     // Ищем ребро
-    Vertex* temp = searchVertex(origin, destination);
+    const Vertex* temp = searchVertex(origin, destination);
     if (temp == nullptr) throw std::logic_error("Such a vertex does not exist");
     double weight = temp->weight_;
+    vertexCount_--;
+    if (weight <= 0) nonPositiveVertexes_--;
 
     // Удаляем ребро
-    originVertexes->remove(*temp);
+    mutableOutgoing(origin).erase(destination);
+    mutableIncoming(destination).erase(origin);
+    version_ = nextVersion();
     return weight;
 }
 
 std::unordered_map<size_t, double> DirectedGraph::dijkstra(size_t origin) const 
 {
-    if (!adjacencyList_[origin]) throw std::invalid_argument("Origin node does not exist"); // Проверка на существование исходного узла
-    if (!isOnlyPositiveVertexes()) throw std::logic_error("This graph contains vertexes with negative weights, which prevents Dijkstra's algorithm from running"); // Проверка что все рёюра положительные
+    return dijkstraPaths(origin).toMap();
+}
+
+std::unordered_map<size_t, double> DirectedGraph::bellmanFord(size_t origin) const
+{
+    return bellmanFordPaths(origin).toMap();
+}
+
+ShortestPaths DirectedGraph::bellmanFordPaths(size_t origin) const
+{
+    // Проверка на существование исходного узла
+    if (searchNode(origin) == false) throw std::invalid_argument("Origin node does not exist");
+
+    std::vector<size_t> starts;
+    std::vector<size_t> destinations;
+    std::vector<double> weights;
+    ShortestPaths result; // Плотные массивы расстояний и предков
+    bellmanFordInto(origin, starts, destinations, weights, result);
+    return result;
+}
+
+void DirectedGraph::bellmanFordInto(size_t origin, std::vector<size_t>& starts, std::vector<size_t>& destinations, std::vector<double>& weights, ShortestPaths& result) const
+{
+    // Сбор всех рёбер графа в параллельные массивы (источник, назначение, вес)
+    starts.clear();
+    destinations.clear();
+    weights.clear();
+    for (size_t key = 0; key < size_; ++key) 
+    {
+        if (auto& vertexes = outgoing(key))
+        {
+            for (const auto& vertex : *vertexes)
+            {
+                starts.push_back(key);
+                destinations.push_back(vertex.destination_);
+                weights.push_back(vertex.weight_);
+            }
+        }
+    }
 
     // Инициализация расстояний
-    std::priority_queue<std::pair<double, size_t>, std::vector<std::pair<double, size_t>>, std::greater<>> queue; // Очередь обхода узлов
-    std::unordered_map<size_t, double> distances; // таблица узлов и расстояний
+    result.reset(origin, size_);
+    auto& distances = result.distances_;
+    const double infinity = std::numeric_limits<double>::infinity();
 
     // Установка начальных значений
-    for (size_t i = 0; i < adjacencyList_.size(); ++i) 
+    for (size_t i = 0; i < size_; ++i) 
     {
-        if (adjacencyList_[i]) 
+        if (outgoing(i)) result.present_[i] = true;
+    }
+    distances[origin] = 0.0;
+
+    // Релаксация рёбер (не более n-1 итераций)
+    bool changed = true;
+    for (size_t i = 1; (i < realSize_) && changed; ++i) 
+    {
+        changed = false;
+        for (size_t edge = 0; edge < starts.size(); ++edge) 
         {
-            distances[i] = std::numeric_limits<double>::infinity();
+            double startDist = distances[starts[edge]];
+            if ((startDist != infinity) && (startDist + weights[edge] < distances[destinations[edge]])) 
+            {
+                distances[destinations[edge]] = startDist + weights[edge];
+                result.predecessors_[destinations[edge]] = starts[edge];
+                changed = true;
+            }
         }
     }
-    distances[origin] = 0.0;
-    queue.emplace(0, origin);
 
-    // Основной цикл обработки узлов
-    while (!queue.empty())
+    // Проверка на отрицательные циклы (не нужна, если последний проход ничего не изменил)
+    if (changed)
+    {
+        for (size_t edge = 0; edge < starts.size(); ++edge) 
+        {
+            double startDist = distances[starts[edge]];
+            if ((startDist != infinity) && (startDist + weights[edge] < distances[destinations[edge]])) 
+            {
+                throw std::logic_error("Graph contains a negative-weight cycle");
+            }
+        }
+    }
+}
+
+ShortestPaths DirectedGraph::spfa(size_t origin) const
+{
+    // Проверка на существование исходного узла
+    if (searchNode(origin) == false) throw std::invalid_argument("Origin node does not exist");
+
+    // Инициализация расстояний
+    ShortestPaths result(origin, size_); // Плотные массивы расстояний и предков
+    auto& distances = result.distances_;
+    std::vector<size_t> edgeCounts(size_, 0); // Число рёбер в текущем пути до узла
+    std::vector<bool> inQueue(size_, false); // Находится ли узел в очереди
+    std::queue<size_t> nodesQueue; // Очередь узлов, расстояние до которых изменилось
+
+    // Установка начальных значений
+    for (size_t i = 0; i < size_; ++i) 
     {
-        auto [currentDist, currentNode] = queue.top();
-        queue.pop();
+        if (outgoing(i)) result.present_[i] = true;
+    }
+    distances[origin] = 0.0;
+    nodesQueue.push(origin);
+    inQueue[origin] = true;
 
-        if (currentDist > distances[currentNode]) continue;
+    while (!nodesQueue.empty())
+    {
+        size_t currentNode = nodesQueue.front();
+        nodesQueue.pop();
+        inQueue[currentNode] = false;
 
-        if (auto& vertexes = adjacencyList_[currentNode]) 
+        for (const auto& vertex : *outgoing(currentNode))
         {
-            // Обход всех смежных узлов
-            for (const auto& vertex : *vertexes) 
+            double newDist = distances[currentNode] + vertex.weight_;
+            if (newDist >= distances[vertex.destination_]) continue;
+
+            distances[vertex.destination_] = newDist;
+            result.predecessors_[vertex.destination_] = currentNode;
+
+            // Путь из n и более рёбер повторяет узел, значит улучшение дал отрицательный цикл
+            edgeCounts[vertex.destination_] = edgeCounts[currentNode] + 1;
+            if (edgeCounts[vertex.destination_] >= realSize_) throw std::logic_error("Graph contains a negative-weight cycle");
+
+            if (!inQueue[vertex.destination_])
             {
-                // Вычисление нового расстояния
-                double newDist = currentDist + vertex.weight_;
-                
-                // Обновление расстояния, если найден более короткий путь
-                if (newDist < distances[vertex.destination_]) 
-                {
-                    distances[vertex.destination_] = newDist;
-                    queue.emplace(newDist, vertex.destination_);
-                }
+                inQueue[vertex.destination_] = true;
+                nodesQueue.push(vertex.destination_);
             }
         }
     }
 
-    distances.erase(origin);
-    return distances;
+    return result;
 }
 
-std::unordered_map<size_t, double> DirectedGraph::bellmanFord(size_t origin) const
+ShortestPaths DirectedGraph::parallelBellmanFord(size_t origin, size_t threads) const
+{
+    return parallelBellmanFord(origin, ThreadPool::local(threads));
+}
+
+ShortestPaths DirectedGraph::parallelBellmanFord(size_t origin, ThreadPool& pool) const
 {
     // Проверка на существование исходного узла
     if (searchNode(origin) == false) throw std::invalid_argument("Origin node does not exist");
 
-    // Сбор всех рёбер графа
-    std::vector<std::tuple<size_t, size_t, double>> allVertexes;
-    for (size_t key = 0; key < adjacencyList_.size(); ++key) 
+    const size_t capacity = size_;
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    // Входящие рёбра в параллельных массивах: рёбра узла key лежат на [offsets[key], offsets[key + 1]).
+    // Разбиение по узлам назначения даёт каждому потоку свою часть рёбер без гонок при записи
+    std::vector<size_t> offsets(capacity + 1, 0);
+    std::vector<size_t> starts;
+    std::vector<double> weights;
+    for (size_t key = 0; key < capacity; ++key)
     {
-        if (auto& vertexes = adjacencyList_[key])
+        if (auto& sources = incoming(key))
         {
-            for (const auto& vertex : *vertexes)
+            for (const auto& vertex : *sources)
             {
-                allVertexes.emplace_back(key, vertex.destination_, vertex.weight_);
+                starts.push_back(vertex.destination_);
+                weights.push_back(vertex.weight_);
             }
         }
+        offsets[key + 1] = starts.size();
     }
 
     // Инициализация расстояний
-    std::unordered_map<size_t, double> distances; // таблица узлов и расстояний
+    ShortestPaths result(origin, capacity); // Плотные массивы расстояний и предков
+    for (size_t i = 0; i < capacity; ++i) 
+    {
+        if (outgoing(i)) result.present_[i] = true;
+    }
+    result.distances_[origin] = 0.0;
 
-    // Установка начальных значений
-    for (size_t i = 0; i < adjacencyList_.size(); ++i) 
+    // Проход читает расстояния предыдущего прохода и пишет в новый массив (метод Якоби)
+    std::vector<double> previous = result.distances_;
+    std::vector<char> threadChanged(pool.size(), 0);
+    bool changed = true;
+
+    // Релаксация рёбер (не более n-1 итераций), затем ещё один проход для проверки на отрицательные циклы
+    for (size_t i = 1; (i <= realSize_) && changed; ++i)
+    {
+        pool.parallelFor(capacity, [&](size_t thread, size_t begin, size_t end)
+        {
+            bool local = false;
+            for (size_t node = begin; node < end; ++node)
+            {
+                for (size_t edge = offsets[node]; edge < offsets[node + 1]; ++edge)
+                {
+                    double startDist = previous[starts[edge]];
+                    if ((startDist != infinity) && (startDist + weights[edge] < result.distances_[node]))
+                    {
+                        result.distances_[node] = startDist + weights[edge];
+                        result.predecessors_[node] = starts[edge];
+                        local = true;
+                    }
+                }
+            }
+            threadChanged[thread] = local;
+        });
+
+        changed = false;
+        for (auto& flag : threadChanged)
+        {
+            changed = changed || flag;
+            flag = 0;
+        }
+
+        if (changed && (i == realSize_)) throw std::logic_error("Graph contains a negative-weight cycle");
+        previous = result.distances_;
+    }
+
+    return result;
+}
+
+ShortestPaths DirectedGraph::deltaStepping(size_t origin, double delta, size_t threads) const
+{
+    return deltaStepping(origin, delta, ThreadPool::local(threads));
+}
+
+ShortestPaths DirectedGraph::deltaStepping(size_t origin, double delta, ThreadPool& pool) const
+{
+    if (searchNode(origin) == false) throw std::invalid_argument("Origin node does not exist"); // Проверка на существование исходного узла
+    if (!(delta > 0) || !std::isfinite(delta)) throw std::invalid_argument("Bucket width must be positive and finite"); // Проверка ширины корзины
+    if (!isOnlyPositiveVertexes()) throw std::logic_error("This graph contains vertexes with negative weights, which prevents Dijkstra's algorithm from running"); // Проверка что все рёбра положительные
+
+    // Запрос на релаксацию: узел, новое расстояние, предок
+    struct Request
     {
-        if (adjacencyList_[i]) 
+        size_t node;
+        double distance;
+        size_t predecessor;
+    };
+
+    const size_t workers = pool.size();
+    const size_t capacity = size_;
+
+    ShortestPaths result(origin, capacity); // Плотные массивы расстояний и предков
+    auto& distances = result.distances_;
+    auto& predecessors = result.predecessors_;
+
+    // Установка начальных значений и поиск максимального веса ребра (рёбра бесконечного веса расстояний не улучшают)
+    double maxWeight = 0.0;
+    for (size_t i = 0; i < capacity; ++i) 
+    {
+        if (!outgoing(i)) continue;
+
+        result.present_[i] = true;
+        for (const auto& vertex : *outgoing(i))
         {
-            distances[i] = std::numeric_limits<double>::infinity();
+            if (std::isfinite(vertex.weight_)) maxWeight = std::max(maxWeight, vertex.weight_);
         }
     }
     distances[origin] = 0.0;
 
-    // Релаксация рёбер (n-1 итераций)
-    for (size_t i = 1; i < realSize_; ++i) 
+    // Слишком узкие корзины расширяются: кольцо не длиннее maxBucketCount, а номер корзины любого
+    // конечного расстояния (не больше capacity * maxWeight) помещается в size_t. Результат от ширины не зависит
+    constexpr size_t maxBucketCount = size_t(1) << 16;
+    delta = std::max(delta, maxWeight / (maxBucketCount - 2));
+
+    // Циклический массив корзин: все ожидающие расстояния лежат в [i * delta, i * delta + maxWeight + delta)
+    const size_t bucketCount = static_cast<size_t>(std::floor(maxWeight / delta)) + 2;
+    std::vector<std::vector<size_t>> buckets(bucketCount);
+    auto bucketOf = [delta](double distance) { return static_cast<size_t>(std::floor(distance / delta)); };
+
+    buckets[0].push_back(origin);
+    size_t pending = 1; // Количество записей во всех корзинах
+
+    // Запросы requests[producer][owner]: узел owner-а обновляет только поток owner
+    std::vector<std::vector<std::vector<Request>>> requests(workers, std::vector<std::vector<Request>>(workers));
+    std::vector<std::vector<size_t>> updated(workers); // Узлы, улучшенные потоком в последней фазе
+    std::vector<size_t> frontier; // Узлы текущей фазы
+    std::vector<size_t> settled; // Узлы, обработанные в текущей корзине
+    std::vector<size_t> frontierMark(capacity, std::numeric_limits<size_t>::max()); // Номер фазы, в которой узел попал во frontier
+    std::vector<size_t> settledMark(capacity, std::numeric_limits<size_t>::max()); // Номер корзины, в которой узел попал в settled
+    size_t phase = 0;
+
+    // Параллельная релаксация рёбер узлов nodes (лёгких или тяжёлых)
+    auto relax = [&](const std::vector<size_t>& nodes, bool light)
     {
-        for (const auto& vertex : allVertexes) 
+        if (nodes.empty()) return;
+        pool.parallelFor(nodes.size(), [&](size_t thread, size_t begin, size_t end)
         {
-            size_t start = std::get<0>(vertex);
-            size_t destination = std::get<1>(vertex);
-            double weight = std::get<2>(vertex);
+            auto& local = requests[thread];
+            for (size_t i = begin; i < end; ++i)
+            {
+                size_t node = nodes[i];
+                for (const auto& vertex : *outgoing(node))
+                {
+                    if ((vertex.weight_ <= delta) != light) continue;
 
-            if ((distances[start] != std::numeric_limits<double>::infinity()) && (distances[start] + weight < distances[destination])) 
+                    double newDist = distances[node] + vertex.weight_;
+                    if (newDist < distances[vertex.destination_])
+                    {
+                        local[vertex.destination_ % workers].push_back(Request{vertex.destination_, newDist, node});
+                    }
+                }
+            }
+        });
+
+        // Каждый поток применяет запросы к своим узлам в порядке номеров источников
+        pool.runOnEach([&](size_t thread, size_t, size_t)
+        {
+            updated[thread].clear();
+            for (size_t producer = 0; producer < workers; ++producer)
             {
-                distances[destination] = distances[start] + weight;
+                for (const auto& request : requests[producer][thread])
+                {
+                    if (request.distance < distances[request.node])
+                    {
+                        distances[request.node] = request.distance;
+                        predecessors[request.node] = request.predecessor;
+                        updated[thread].push_back(request.node);
+                    }
+                }
+                requests[producer][thread].clear();
+            }
+        });
+
+        // Переносим улучшенные узлы в корзины (устаревшие записи отбрасываются при извлечении)
+        for (const auto& nodes : updated)
+        {
+            for (size_t node : nodes)
+            {
+                buckets[bucketOf(distances[node]) % bucketCount].push_back(node);
+                pending++;
             }
         }
+    };
+
+    for (size_t current = 0; pending > 0; ++current)
+    {
+        auto& bucket = buckets[current % bucketCount];
+        if (bucket.empty()) continue; // Пустые корзины пропускаются без обращения к пулу
+        settled.clear();
+
+        // Обрабатываем корзину, пока лёгкие рёбра возвращают в неё узлы
+        while (!bucket.empty())
+        {
+            frontier.clear();
+            for (size_t node : bucket)
+            {
+                if (bucketOf(distances[node]) != current || frontierMark[node] == phase) continue;
+
+                frontierMark[node] = phase;
+                frontier.push_back(node);
+                if (settledMark[node] != current)
+                {
+                    settledMark[node] = current;
+                    settled.push_back(node);
+                }
+            }
+            pending -= bucket.size();
+            bucket.clear();
+            phase++;
+
+            relax(frontier, true);
+        }
+
+        // Тяжёлые рёбра ведут только в последующие корзины
+        relax(settled, false);
     }
 
-    // Проверка на отрицательные циклы
-    for (const auto& vertex : allVertexes) 
+    return result;
+}
+
+double DirectedGraph::shortestPath(size_t origin, size_t destination) const
+{
+    if (searchNode(origin) == false) throw std::invalid_argument("Origin node does not exist"); // Проверка на существование исходного узла
+    if (searchNode(destination) == false) throw std::invalid_argument("Destination node does not exist"); // Проверка на существование узла назначения
+    if (!isOnlyPositiveVertexes()) throw std::logic_error("This graph contains vertexes with negative weights, which prevents Dijkstra's algorithm from running"); // Проверка что все рёбра положительные
+
+    // Инициализация расстояний: затрагиваются только узлы, до которых дошёл поиск
+    SearchState& state = searchState(0);
+    state.reset(size_);
+    state.setDistance(origin, 0.0);
+    state.queue.push(0, origin);
+
+    // Основной цикл обработки узлов
+    while (!state.queue.empty())
     {
-        size_t start = std::get<0>(vertex);
-        size_t destination = std::get<1>(vertex);
-        double weight = std::get<2>(vertex);
-        if (distances[start] != std::numeric_limits<double>::infinity() && distances[start] + weight < distances[destination]) 
+        auto [currentDist, currentNode] = state.queue.pop();
+
+        if (currentDist > state.distance(currentNode)) continue;
+
+        // Узел назначения извлечён из очереди: его расстояние окончательное
+        if (currentNode == destination) return currentDist;
+
+        for (const auto& vertex : *outgoing(currentNode)) 
         {
-            throw std::logic_error("Graph contains a negative-weight cycle");
+            double newDist = currentDist + vertex.weight_;
+            if (newDist < state.distance(vertex.destination_)) 
+            {
+                state.setDistance(vertex.destination_, newDist);
+                state.queue.push(newDist, vertex.destination_);
+            }
         }
     }
 
-    distances.erase(origin);
-    return distances;
+    // Узел назначения недостижим
+    return std::numeric_limits<double>::infinity();
+}
+
+double DirectedGraph::bidirectionalShortestPath(size_t origin, size_t destination) const
+{
+    if (searchNode(origin) == false) throw std::invalid_argument("Origin node does not exist"); // Проверка на существование исходного узла
+    if (searchNode(destination) == false) throw std::invalid_argument("Destination node does not exist"); // Проверка на существование узла назначения
+    if (!isOnlyPositiveVertexes()) throw std::logic_error("This graph contains vertexes with negative weights, which prevents Dijkstra's algorithm from running"); // Проверка что все рёбра положительные
+    if (origin == destination) return 0.0;
+
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    // Прямой поиск идёт от origin по исходящим рёбрам, обратный — от destination по входящим.
+    // Расстояния и очереди обоих направлений берутся из состояний потока и инициализируются лениво
+    SearchState* states[2] = {&searchState(0), &searchState(1)};
+    BinaryHeapQueue* queues[2] = {&states[0]->queue, &states[1]->queue};
+    states[0]->reset(size_);
+    states[1]->reset(size_);
+
+    states[0]->setDistance(origin, 0.0);
+    states[1]->setDistance(destination, 0.0);
+    queues[0]->push(0.0, origin);
+    queues[1]->push(0.0, destination);
+
+    double best = infinity; // Длина лучшего найденного пути через точку встречи
+
+    while (!queues[0]->empty() && !queues[1]->empty())
+    {
+        // Ни один ещё не найденный путь не может быть короче суммы минимумов двух очередей
+        if (queues[0]->top().first + queues[1]->top().first >= best) break;
+
+        // Расширяем направление с меньшей очередью
+        size_t side = (queues[0]->size() <= queues[1]->size()) ? 0 : 1;
+        auto [currentDist, currentNode] = queues[side]->pop();
+
+        if (currentDist > states[side]->distance(currentNode)) continue;
+
+        for (const auto& vertex : *edges(currentNode, side == 1))
+        {
+            size_t neighbor = vertex.destination_;
+            double newDist = currentDist + vertex.weight_;
+
+            if (newDist < states[side]->distance(neighbor))
+            {
+                states[side]->setDistance(neighbor, newDist);
+                queues[side]->push(newDist, neighbor);
+            }
+
+            // Обновляем лучший путь, если сосед уже достигнут встречным поиском
+            double other = states[1 - side]->distance(neighbor);
+            if (other != infinity && newDist + other < best) best = newDist + other;
+        }
+    }
+
+    return best;
+}
+
+double DirectedGraph::aStar(size_t origin, size_t destination, const Heuristic& heuristic, size_t* settledNodes) const
+{
+    if (searchNode(origin) == false) throw std::invalid_argument("Origin node does not exist"); // Проверка на существование исходного узла
+    if (searchNode(destination) == false) throw std::invalid_argument("Destination node does not exist"); // Проверка на существование узла назначения
+    if (!isOnlyPositiveVertexes()) throw std::logic_error("This graph contains vertexes with negative weights, which prevents Dijkstra's algorithm from running"); // Проверка что все рёбра положительные
+
+    const double infinity = std::numeric_limits<double>::infinity();
+    size_t settled = 0;
+    double result = infinity;
+
+    // Приоритет узла — расстояние до него плюс оценка эвристики, которая вычисляется один раз на узел
+    SearchState& state = searchState(0);
+    state.reset(size_);
+    state.estimates[origin] = heuristic(origin);
+    state.setDistance(origin, 0.0);
+    if (state.estimates[origin] != infinity) state.queue.push(state.estimates[origin], origin);
+
+    while (!state.queue.empty())
+    {
+        auto [priority, currentNode] = state.queue.pop();
+        double currentDist = state.distance(currentNode);
+
+        if (priority > currentDist + state.estimates[currentNode]) continue; // Устаревшая пара из очереди
+        settled++;
+
+        // Узел назначения извлечён из очереди: при допустимой эвристике его расстояние окончательное
+        if (currentNode == destination)
+        {
+            result = currentDist;
+            break;
+        }
+
+        for (const auto& vertex : *outgoing(currentNode))
+        {
+            size_t neighbor = vertex.destination_;
+            double newDist = currentDist + vertex.weight_;
+            if (newDist < state.distance(neighbor))
+            {
+                if (!state.visited(neighbor)) state.estimates[neighbor] = heuristic(neighbor);
+                state.setDistance(neighbor, newDist);
+                if (state.estimates[neighbor] != infinity) state.queue.push(newDist + state.estimates[neighbor], neighbor); // Из узла с бесконечной оценкой цель недостижима
+            }
+        }
+    }
+
+    if (settledNodes != nullptr) *settledNodes = settled;
+    return result;
 }
 
 size_t DirectedGraph::wave(size_t origin, size_t destination) const
@@ -277,44 +848,253 @@ size_t DirectedGraph::wave(size_t origin, size_t destination) const
     if (!searchNode(destination)) throw std::invalid_argument("Destination node is not in the graph");
     if (origin == destination) return 0;
 
-    // Инициализация расстояний
-    std::queue<size_t> nodesQueue;          // Очередь обхода узлов
-    std::unordered_map<size_t, size_t> distances; // Хранит расстояние от origin до каждого узла
+    // Обход в ширину останавливается, как только найден узел назначения. Посещённые узлы отмечаются
+    // эпохой состояния потока, поэтому подготовка к запросу не зависит от размера графа
+    SearchState& state = searchState(0);
+    state.reset(size_);
+    std::vector<size_t>& nodesQueue = state.nodes;
+    nodesQueue.clear();
+    nodesQueue.push_back(origin);
+    state.setDistance(origin, 0.0);
 
-    // Инициализация начальной вершины
-    nodesQueue.push(origin);
-    distances[origin] = 0;
+    for (size_t head = 0; head < nodesQueue.size(); ++head)
+    {
+        size_t currentNode = nodesQueue[head];
+        double level = state.distances[currentNode] + 1;
+        for (const auto& vertex : *outgoing(currentNode))
+        {
+            size_t neighbor = vertex.destination_;
+            if (state.visited(neighbor)) continue;
+            if (neighbor == destination) return static_cast<size_t>(level);
 
-    // Цикл обхода узлов
-    while (!nodesQueue.empty()) 
+            state.setDistance(neighbor, level);
+            nodesQueue.push_back(neighbor);
+        }
+    }
+
+    // Если путь не найден
+    throw std::logic_error("No path exists between the nodes");
+}
+
+std::vector<size_t> DirectedGraph::waveAll(size_t origin, size_t threads) const
+{
+    // Проверка на наличие узла в графе
+    if (!searchNode(origin)) throw std::invalid_argument("Origin node is not in the graph");
+
+    return waveLevels(origin, ThreadPool::local(threads));
+}
+
+std::vector<size_t> DirectedGraph::waveAll(size_t origin, ThreadPool& pool) const
+{
+    // Проверка на наличие узла в графе
+    if (!searchNode(origin)) throw std::invalid_argument("Origin node is not in the graph");
+
+    return waveLevels(origin, pool);
+}
+
+std::vector<size_t> DirectedGraph::waveLevels(size_t origin, ThreadPool& pool) const
+{
+    // Параметры переключения направления обхода (Beamer et al.)
+    const size_t alpha = 14; // Переход к обходу снизу вверх, когда рёбер фронта больше 1/alpha непросмотренных
+    const size_t beta = 24; // Возврат к обходу сверху вниз, когда фронт меньше 1/beta узлов
+
+    const size_t capacity = size_;
+    const size_t words = (capacity + 63) / 64;
+
+    std::vector<size_t> hops(capacity, unreachable); // Число рёбер от origin до узлов
+    std::vector<std::atomic<uint64_t>> visited(words); // Битовая карта посещённых узлов
+    std::vector<uint64_t> frontierBits(words, 0); // Битовая карта текущего фронта (для обхода снизу вверх)
+    std::vector<size_t> frontier; // Текущий фронт списком (для обхода сверху вниз)
+    std::vector<std::vector<size_t>> nextParts(pool.size()); // Следующий фронт по потокам
+
+    // Число непросмотренных рёбер для эвристики выбора направления (граф хранит общее число рёбер)
+    size_t unexploredEdges = vertexCount_;
+
+    hops[origin] = 0;
+    visited[origin / 64].fetch_or(uint64_t(1) << (origin % 64), std::memory_order_relaxed);
+    frontier.push_back(origin);
+    bool bottomUp = false;
+
+    for (size_t level = 0; !frontier.empty(); ++level)
     {
-        size_t currentNode = nodesQueue.front();
-        nodesQueue.pop();
+        // Выбор направления по размеру фронта
+        size_t frontierEdges = 0;
+        for (size_t node : frontier)
+        {
+            frontierEdges += outgoing(node)->size();
+        }
+        unexploredEdges -= std::min(unexploredEdges, frontierEdges);
+
+        if (!bottomUp && frontierEdges > unexploredEdges / alpha) bottomUp = true;
+        else if (bottomUp && frontier.size() < realSize_ / beta) bottomUp = false;
+
+        if (bottomUp)
+        {
+            // Снизу вверх: каждый непосещённый узел ищет родителя во фронте среди входящих рёбер
+            std::fill(frontierBits.begin(), frontierBits.end(), 0);
+            for (size_t node : frontier)
+            {
+                frontierBits[node / 64] |= uint64_t(1) << (node % 64);
+            }
+
+            pool.parallelFor(capacity, [&](size_t thread, size_t begin, size_t end)
+            {
+                auto& next = nextParts[thread];
+                next.clear();
+                for (size_t node = begin; node < end; ++node)
+                {
+                    if (!incoming(node)) continue;
+                    if (visited[node / 64].load(std::memory_order_relaxed) & (uint64_t(1) << (node % 64))) continue;
+
+                    for (const auto& source : *incoming(node))
+                    {
+                        size_t parent = source.destination_;
+                        if (frontierBits[parent / 64] & (uint64_t(1) << (parent % 64)))
+                        {
+                            hops[node] = level + 1;
+                            next.push_back(node);
+                            break;
+                        }
+                    }
+                }
+            });
+
+            // Отмечаем найденные узлы после прохода, чтобы они не стали родителями на этом же уровне
+            for (const auto& next : nextParts)
+            {
+                for (size_t node : next)
+                {
+                    visited[node / 64].fetch_or(uint64_t(1) << (node % 64), std::memory_order_relaxed);
+                }
+            }
+        }
+        else
+        {
+            // Сверху вниз: узлы фронта захватывают непосещённых соседей атомарной установкой бита
+            pool.parallelFor(frontier.size(), [&](size_t thread, size_t begin, size_t end)
+            {
+                auto& next = nextParts[thread];
+                next.clear();
+                for (size_t i = begin; i < end; ++i)
+                {
+                    for (const auto& vertex : *outgoing(frontier[i]))
+                    {
+                        size_t neighbor = vertex.destination_;
+                        uint64_t bit = uint64_t(1) << (neighbor % 64);
+                        if (visited[neighbor / 64].load(std::memory_order_relaxed) & bit) continue;
+
+                        // Узел достаётся тому потоку, который первым установил бит
+                        if ((visited[neighbor / 64].fetch_or(bit, std::memory_order_relaxed) & bit) == 0)
+                        {
+                            hops[neighbor] = level + 1;
+                            next.push_back(neighbor);
+                        }
+                    }
+                }
+            });
+        }
+
+        // Собираем следующий фронт
+        frontier.clear();
+        for (auto& next : nextParts)
+        {
+            frontier.insert(frontier.end(), next.begin(), next.end());
+            next.clear();
+        }
+    }
+
+    return hops;
+}
+
+CompressedGraph DirectedGraph::freeze() const
+{
+    auto arrays = std::make_shared<CompressedGraph::Arrays>();
+    arrays->present.assign((size_ + 63) / 64, 0);
+    arrays->offsets.assign(size_ + 1, 0);
+
+    // Подсчитываем степени узлов, чтобы выделить массивы рёбер одним блоком
+    for (size_t key = 0; key < size_; ++key)
+    {
+        size_t degree = 0;
+        if (outgoing(key))
+        {
+            arrays->present[key / 64] |= uint64_t(1) << (key % 64);
+            degree = outgoing(key)->size();
+        }
+        arrays->offsets[key + 1] = arrays->offsets[key] + degree;
+    }
+
+    // Переносим рёбра в непрерывные массивы
+    arrays->destinations.reserve(arrays->offsets.back());
+    arrays->weights.reserve(arrays->offsets.back());
+    for (size_t key = 0; key < size_; ++key)
+    {
+        auto& vertexes = outgoing(key);
+        if (!vertexes.has_value()) continue;
 
-        // Если достигли целевого узла, возвращаем расстояние
-        if (currentNode == destination) 
+        for (const auto& vertex : *vertexes)
         {
-            return distances[currentNode];
+            arrays->destinations.push_back(vertex.destination_);
+            arrays->weights.push_back(vertex.weight_);
         }
+    }
+
+    CompressedGraph frozen;
+    frozen.capacity_ = size_;
+    frozen.realSize_ = realSize_;
+    frozen.vertexCount_ = arrays->destinations.size();
+    frozen.onlyPositive_ = isOnlyPositiveVertexes();
+    frozen.attach(std::move(arrays));
+    return frozen;
+}
+
+ShortestPaths DirectedGraph::wavePaths(size_t origin) const
+{
+    // Проверка на наличие узла в графе
+    if (!searchNode(origin)) throw std::invalid_argument("Origin node is not in the graph");
+
+    std::vector<size_t> nodesQueue; // Очередь обхода узлов
+    ShortestPaths result; // Число рёбер до узлов и предки
+    waveInto(origin, unreachable, nodesQueue, result);
+    return result;
+}
+
+void DirectedGraph::waveInto(size_t origin, size_t destination, std::vector<size_t>& nodesQueue, ShortestPaths& result) const
+{
+    // Инициализация расстояний
+    result.reset(origin, size_);
+    auto& distances = result.distances_;
 
-        // Получаем список смежных узлов
-        const auto& edges = adjacencyList_.at(currentNode);
-        if (!edges) continue; // У узла нет рёбер
+    for (size_t i = 0; i < size_; ++i) 
+    {
+        if (outgoing(i)) result.present_[i] = true;
+    }
+
+    // Очередь хранится в векторе: узлы не удаляются, а пропускаются сдвигом головы
+    nodesQueue.clear();
+    nodesQueue.push_back(origin);
+    distances[origin] = 0;
+
+    // Цикл обхода узлов
+    for (size_t head = 0; head < nodesQueue.size(); ++head) 
+    {
+        size_t currentNode = nodesQueue[head];
+
+        // Если достигли целевого узла, его расстояние окончательное
+        if (currentNode == destination) return;
 
         // Обход всех рёбер текущего узла
-        for (const auto& vertex : *edges) 
+        for (const auto& vertex : *outgoing(currentNode)) 
         {
             size_t neighbor = vertex.destination_;
 
             // Если соседний узел ещё не посещён
-            if (distances.find(neighbor) == distances.end()) 
+            if (distances[neighbor] == std::numeric_limits<double>::infinity()) 
             {
                 distances[neighbor] = distances[currentNode] + 1;
-                nodesQueue.push(neighbor);
+                result.predecessors_[neighbor] = currentNode;
+                nodesQueue.push_back(neighbor);
             }
         }
     }
-
-    // Если путь не найден
-    throw std::logic_error("No path exists between the nodes");
 }
@@ -3,82 +3,104 @@
 
 #include <iostream>
 #include <vector>
-#include <list>
 #include <unordered_map>
 #include <memory>
+#include <memory_resource>
+#include <optional>
+#include <limits>
+#include <stdexcept>
+#include <functional>
+#include "compressed_graph.h"
+#include "shortest_paths.h"
+#include "priority_queues.h"
+#include "edge_list.h"
+
+class ThreadPool;
 
 class DirectedGraph
 {
 public:
+    // Число рёбер до недостижимого или отсутствующего узла в результате waveAll
+    static constexpr size_t unreachable = std::numeric_limits<size_t>::max();
+
+    // Эвристика A*: нижняя оценка расстояния от узла до узла назначения запроса
+    using Heuristic = std::function<double(size_t node)>;
+
+    // Запись ребра для пакетного добавления
+    struct VertexRecord
+    {
+        size_t origin; // Номер узла источника
+        double weight; // Вес ребра
+        size_t destination; // Номер узла назначения
+    };
+
     // Конструктор по умолчанию
     DirectedGraph(): 
-        size_(5), 
-        realSize_(0) 
-    {
-        adjacencyList_.resize(size_); // Все элементы будут nullptr
-    }
+        DirectedGraph(5)
+    {}
 
-    // Конструктор с параметром
-    DirectedGraph(size_t size): 
+    // Конструктор с параметрами: вместимость и источник памяти, из которого пул графа берёт блоки.
+    // Списки рёбер графа и всех его копий выделяются из одного синхронизированного пула, который
+    // возвращает память источнику целиком после удаления последней копии. Источник должен существовать
+    // дольше графа и всех его копий; если копии изменяются или удаляются в разных потоках, пул может
+    // обращаться к источнику из этих потоков, поэтому источник должен быть потокобезопасным, как источник
+    // по умолчанию. std::pmr::monotonic_buffer_resource не потокобезопасен и не освобождает память до
+    // своего удаления: он подходит только для графов, которые строятся и удаляются целиком в одном потоке
+    DirectedGraph(size_t size, std::pmr::memory_resource* upstream = std::pmr::get_default_resource()): 
         size_(size), 
-        realSize_(0) 
-    {
-        adjacencyList_.resize(size_); 
-    }
+        realSize_(0),
+        vertexCount_(0),
+        nonPositiveVertexes_(0),
+        version_(nextVersion()),
+        pool_(std::make_shared<std::pmr::synchronized_pool_resource>(upstream)),
+        chunks_(std::make_shared<ChunkTable>(groupCount(size)))
+    {}
+
+    // Конструктор из неизменяемого снимка (восстановление графа из двоичного файла)
+    explicit DirectedGraph(const CompressedGraph& snapshot);
 
-    // Конструктор копирования
+    // Конструктор копирования: за O(1), копия разделяет блоки узлов с оригиналом, а изменение
+    // любого из них копирует только затронутые блоки. Копию можно читать в другом потоке, пока оригинал
+    // изменяется; само копирование не должно выполняться одновременно с изменением оригинала
     DirectedGraph(const DirectedGraph& other): 
         size_(other.size_),
-        realSize_(other.realSize_)
-    {
-        adjacencyList_.reserve(other.adjacencyList_.size());
-        for (const auto& other_list : other.adjacencyList_) 
-        {
-            if (other_list) 
-            {
-                // Создаем копию списка
-                adjacencyList_.push_back(std::make_unique<std::list<Vertex>>(*other_list));
-            } 
-            else 
-            {
-                adjacencyList_.push_back(nullptr);
-            }
-        }
-    }
+        realSize_(other.realSize_),
+        vertexCount_(other.vertexCount_),
+        nonPositiveVertexes_(other.nonPositiveVertexes_),
+        version_(other.version_), // Копия совпадает с оригиналом, поэтому их результаты взаимозаменяемы
+        pool_(other.pool_),
+        chunks_(other.chunks_)
+    {}
 
     // Конструктор перемещения
     DirectedGraph(DirectedGraph&& other) noexcept: 
         size_(other.size_),
         realSize_(other.realSize_),
-        adjacencyList_(std::move(other.adjacencyList_)) 
+        vertexCount_(other.vertexCount_),
+        nonPositiveVertexes_(other.nonPositiveVertexes_),
+        version_(other.version_),
+        pool_(other.pool_),
+        chunks_(std::move(other.chunks_))
     {
         other.size_ = 0;
         other.realSize_ = 0;
+        other.vertexCount_ = 0;
+        other.nonPositiveVertexes_ = 0;
+        other.version_ = nextVersion();
     }
 
-    // Оператор копирующего присваивания
+    // Оператор копирующего присваивания (за O(1), как и копирование)
     DirectedGraph& operator=(const DirectedGraph& copy) 
     {
         if (this == &copy) return *this;
 
-        // Очищаем текущие данные
-        adjacencyList_.clear();
         size_ = copy.size_;
         realSize_ = copy.realSize_;
-
-        // Копируем списки
-        adjacencyList_.reserve(copy.adjacencyList_.size());
-        for (const auto& copy_list : copy.adjacencyList_) 
-        {
-            if (copy_list) 
-            {
-                adjacencyList_.push_back(std::make_unique<std::list<Vertex>>(*copy_list));
-            } 
-            else 
-            {
-                adjacencyList_.push_back(nullptr);
-            }
-        }
+        vertexCount_ = copy.vertexCount_;
+        nonPositiveVertexes_ = copy.nonPositiveVertexes_;
+        version_ = copy.version_;
+        pool_ = copy.pool_;
+        chunks_ = copy.chunks_;
 
         return *this;
     }
@@ -88,17 +110,21 @@ public:
     {
         if (this == &moved) return *this;
         
-        // Освобождаем текущие данные
-        adjacencyList_.clear();
-        
-        // Переносим данные
+        // Переносим данные (прежние блоки освобождаются, если их больше никто не разделяет)
         size_ = moved.size_;
         realSize_ = moved.realSize_;
-        adjacencyList_ = std::move(moved.adjacencyList_);
+        vertexCount_ = moved.vertexCount_;
+        nonPositiveVertexes_ = moved.nonPositiveVertexes_;
+        version_ = moved.version_;
+        pool_ = moved.pool_; // Пул остаётся и у исходника, чтобы после перемещения его можно было заполнять
+        chunks_ = std::move(moved.chunks_);
         
         // Обнуляем исходник
         moved.size_ = 0;
         moved.realSize_ = 0;
+        moved.vertexCount_ = 0;
+        moved.nonPositiveVertexes_ = 0;
+        moved.version_ = nextVersion();
         return *this;
     }
 
@@ -111,6 +137,9 @@ public:
     bool isEmpty() const;
     // Получение количества элементов в графе
     size_t size() const;
+    // Получение версии графа: меняется при каждом изменении и уникальна среди всех графов,
+    // поэтому одинаковые версии означают одинаковое содержимое (например, у копии)
+    size_t version() const;
 
     // Проверка наличия узла в графе
     bool searchNode(size_t key) const;
@@ -121,6 +150,10 @@ public:
 
     // Добавление ребра между узлами
     void addVertex(size_t origin, double weight, size_t destination);
+    // Пакетное добавление рёбер в порядке записей с созданием отсутствующих узлов.
+    // Обратные к существующим рёбра пропускаются; возвращает число пропущенных записей,
+    // их номера дописываются в skippedIndexes, если он передан
+    size_t addVertexes(const std::vector<VertexRecord>& vertexes, std::vector<size_t>* skippedIndexes = nullptr);
     // Проверка наличия ребра между заданными узлами графа
     bool hasVertex(size_t origin, size_t destination) const; 
     // Удаление ребра между заданными узлами графа
@@ -130,10 +163,65 @@ public:
     std::unordered_map<size_t, double> dijkstra(size_t origin) const;
     // Алгоритм Беллмана — Форда для поиска кратчайших путей
     std::unordered_map<size_t, double> bellmanFord(size_t origin) const;
+    // Алгоритм Дейкстры с результатом в плотных массивах (расстояния и предки).
+    // Queue — очередь с приоритетом из priority_queues.h или совместимая с ней
+    template <class Queue = BinaryHeapQueue>
+    ShortestPaths dijkstraPaths(size_t origin) const;
+    // Алгоритм Дейкстры по входящим рёбрам: расстояния от всех узлов до заданного;
+    // предок узла в результате — следующий узел на кратчайшем пути к destination
+    template <class Queue = BinaryHeapQueue>
+    ShortestPaths reverseDijkstraPaths(size_t destination) const;
+    // Алгоритм Беллмана — Форда с результатом в плотных массивах (расстояния и предки)
+    ShortestPaths bellmanFordPaths(size_t origin) const;
+    // Алгоритм Беллмана — Форда с очередью (SPFA)
+    ShortestPaths spfa(size_t origin) const;
+    // Параллельный алгоритм Беллмана — Форда: рёбра делятся между потоками по узлам назначения (0 — по числу ядер)
+    // Потоки берутся из пула вызывающего потока (ThreadPool::local) и переиспользуются между вызовами
+    ShortestPaths parallelBellmanFord(size_t origin, size_t threads = 0) const;
+    // Параллельный алгоритм Беллмана — Форда на потоках переданного пула
+    ShortestPaths parallelBellmanFord(size_t origin, ThreadPool& pool) const;
+    // Параллельный алгоритм delta-stepping: ширина корзины delta, число потоков threads (0 — по числу ядер).
+    // Ширина должна быть положительной и конечной; слишком узкие корзины расширяются до 1/65534 наибольшего веса
+    // Потоки берутся из пула вызывающего потока (ThreadPool::local) и переиспользуются между вызовами
+    ShortestPaths deltaStepping(size_t origin, double delta, size_t threads = 0) const;
+    // Алгоритм delta-stepping на потоках переданного пула
+    ShortestPaths deltaStepping(size_t origin, double delta, ThreadPool& pool) const;
+    // Алгоритм Дейкстры для одной пары узлов с остановкой после достижения узла назначения
+    double shortestPath(size_t origin, size_t destination) const;
+    // Двунаправленный алгоритм Дейкстры для одной пары узлов (встречный поиск по обратным рёбрам)
+    double bidirectionalShortestPath(size_t origin, size_t destination) const;
+    // Алгоритм A* для одной пары узлов. Эвристика должна быть допустимой (не превышать расстояние до destination);
+    // бесконечная оценка означает, что из узла destination недостижим. Число извлечённых из очереди узлов
+    // записывается в settledNodes, если он передан
+    double aStar(size_t origin, size_t destination, const Heuristic& heuristic, size_t* settledNodes = nullptr) const;
     // Волновой алгоритм для поиска кратчайшего пути между заданной парой вершин
-    size_t wave(size_t origin, size_t destination) const;    
+    size_t wave(size_t origin, size_t destination) const;
+    // Волновой алгоритм из заданного узла до всех узлов с деревом предков (расстояние — число рёбер)
+    ShortestPaths wavePaths(size_t origin) const;
+    // Параллельный волновой алгоритм с выбором направления обхода: число рёбер от заданного узла до всех узлов (0 — по числу ядер)
+    // Потоки берутся из пула вызывающего потока (ThreadPool::local) и переиспользуются между вызовами
+    std::vector<size_t> waveAll(size_t origin, size_t threads = 0) const;
+    // Параллельный волновой алгоритм на потоках переданного пула
+    std::vector<size_t> waveAll(size_t origin, ThreadPool& pool) const;    
+
+    // Построение неизменяемого CSR-снимка графа для запросов только на чтение
+    CompressedGraph freeze() const;
+
+    // Обход узлов графа в порядке возрастания номеров: visitor(key)
+    template <class Visitor>
+    void forEachNode(Visitor&& visitor) const;
+    // Обход рёбер графа по узлам источника в порядке возрастания номеров: visitor(origin, weight, destination)
+    template <class Visitor>
+    void forEachVertex(Visitor&& visitor) const;
 
 private:
+    // Пакетные запросы используют варианты алгоритмов с внешними буферами
+    friend class BatchQueryEngine;
+    // Динамические кратчайшие пути читают входящие рёбра узлов
+    friend class DynamicShortestPaths;
+    // Снимок записывается в файл прямо из списков смежности
+    friend class CompressedGraph;
+
     // Структура ребра
     struct Vertex
     {
@@ -147,18 +235,209 @@ private:
         }
     };
 
+    // Рёбра одного узла с быстрым поиском по узлу назначения
+    using VertexList = EdgeList<Vertex>;
+
+    // Число узлов в блоке: блок — единица совместного использования памяти копиями графа
+    static constexpr size_t chunkBits = 6;
+    static constexpr size_t chunkSize = size_t(1) << chunkBits;
+
+    // Блок из chunkSize подряд идущих узлов с их исходящими и входящими рёбрами. Копии графа разделяют
+    // блоки и копируют блок при первом изменении (copy-on-write), поэтому изменяет блок только его
+    // единственный владелец. Блок может пережить граф, поэтому сам удерживает пул своих списков
+    struct Chunk
+    {
+        std::shared_ptr<std::pmr::synchronized_pool_resource> pool; // Пул списков (объявлен первым, чтобы пережить их)
+        std::optional<VertexList> outgoing[chunkSize]; // Исходящие рёбра узлов (пусто — узла нет)
+        std::optional<VertexList> incoming[chunkSize]; // Входящие рёбра узлов (destination_ хранит узел источника)
+
+        // Конструктор пустого блока со списками из пула
+        explicit Chunk(std::shared_ptr<std::pmr::synchronized_pool_resource> listPool);
+        // Копирование блока со списками в том же пуле
+        Chunk(const Chunk& other);
+    };
+
+    // Число блоков в группе: изменение графа копирует только свою группу указателей на блоки
+    static constexpr size_t groupBits = 6;
+    static constexpr size_t groupSize = size_t(1) << groupBits;
+    static constexpr size_t groupShift = chunkBits + groupBits; // Номер группы узла — key >> groupShift
+
+    // Группа из groupSize подряд идущих блоков (nullptr — в блоке нет узлов), разделяется копиями как блок
+    struct ChunkGroup
+    {
+        std::shared_ptr<Chunk> chunks[groupSize];
+    };
+    // Таблица групп (nullptr — в группе нет узлов). Первое изменение копии копирует таблицу, группу и блок
+    // узла: O(V / 4096 + 64) указателей вместо указателя на каждый блок
+    using ChunkTable = std::vector<std::shared_ptr<ChunkGroup>>;
+
     size_t size_; // Вместимость графа
     size_t realSize_; // Количество узов в графе
-    std::vector<std::unique_ptr<std::list<Vertex>>> adjacencyList_; // Представление графа в виде списка смежности
+    size_t vertexCount_; // Количество рёбер (поддерживается при каждом изменении)
+    size_t nonPositiveVertexes_; // Количество рёбер с неположительным весом (поддерживается при каждом изменении)
+    size_t version_; // Версия содержимого графа
+    std::shared_ptr<std::pmr::synchronized_pool_resource> pool_; // Пул списков рёбер (общий для графа и его копий)
+    std::shared_ptr<ChunkTable> chunks_; // Списки смежности по блокам узлов (nullptr после перемещения графа)
+
+    static const std::optional<VertexList> absent_; // Пустой список для узлов из отсутствующих блоков
 
     // Методы
 
+    // Выдача новой версии графа
+    static size_t nextVersion();
     // Поиск ребра между двумя узлами
-    Vertex* searchVertex(size_t origin, size_t destination) const;
-    // Проверка имеют ли все рёбра положительные веса
+    const Vertex* searchVertex(size_t origin, size_t destination) const;
+    // Число групп блоков для заданной вместимости
+    static size_t groupCount(size_t capacity)
+    {
+        return (capacity + (size_t(1) << groupShift) - 1) >> groupShift;
+    }
+    // Блок узла key < size_ (nullptr, если в блоке нет узлов)
+    const Chunk* chunk(size_t key) const
+    {
+        const ChunkGroup* group = (*chunks_)[key >> groupShift].get();
+        return (group != nullptr) ? group->chunks[(key >> chunkBits) & (groupSize - 1)].get() : nullptr;
+    }
+    // Исходящие рёбра узла key < size_ (пусто, если узла нет)
+    const std::optional<VertexList>& outgoing(size_t key) const
+    {
+        const Chunk* nodes = chunk(key);
+        return (nodes != nullptr) ? nodes->outgoing[key & (chunkSize - 1)] : absent_;
+    }
+    // Входящие рёбра узла key < size_ (пусто, если узла нет)
+    const std::optional<VertexList>& incoming(size_t key) const
+    {
+        const Chunk* nodes = chunk(key);
+        return (nodes != nullptr) ? nodes->incoming[key & (chunkSize - 1)] : absent_;
+    }
+    // Рёбра узла в направлении поиска (входящие при reverse == true)
+    const std::optional<VertexList>& edges(size_t key, bool reverse) const
+    {
+        return reverse ? incoming(key) : outgoing(key);
+    }
+    // Блок узла, которым граф владеет единолично (разделённые таблица, группа и блок копируются)
+    Chunk& ownChunk(size_t key);
+    // Изменяемые исходящие рёбра существующего узла
+    VertexList& mutableOutgoing(size_t key)
+    {
+        return *ownChunk(key).outgoing[key & (chunkSize - 1)];
+    }
+    // Изменяемые входящие рёбра существующего узла
+    VertexList& mutableIncoming(size_t key)
+    {
+        return *ownChunk(key).incoming[key & (chunkSize - 1)];
+    }
+    // Расширение таблицы групп до вместимости size_
+    void growChunks();
+    // Создание пустых списков рёбер узла
+    void createLists(size_t key);
+    // Проверка имеют ли все рёбра положительные веса (за O(1) по счётчику рёбер)
     bool isOnlyPositiveVertexes() const;
+    // Алгоритм Дейкстры в переданные буферы; destination == unreachable — до всех узлов, иначе остановка на нём.
+    // При reverse == true поиск идёт по входящим рёбрам
+    template <class Queue>
+    void dijkstraInto(size_t origin, size_t destination, Queue& queue, ShortestPaths& result, bool reverse = false) const;
+    // Алгоритм Беллмана — Форда в переданные буферы (массивы рёбер переиспользуются)
+    void bellmanFordInto(size_t origin, std::vector<size_t>& starts, std::vector<size_t>& destinations, std::vector<double>& weights, ShortestPaths& result) const;
+    // Волновой алгоритм в переданные буферы; destination == unreachable — до всех узлов, иначе остановка на нём
+    void waveInto(size_t origin, size_t destination, std::vector<size_t>& nodesQueue, ShortestPaths& result) const;
+    // Параллельный обход в ширину по уровням (сверху вниз или снизу вверх) до всех узлов
+    std::vector<size_t> waveLevels(size_t origin, ThreadPool& pool) const;
 
     
 
 };
-#endif
+
+// Шаблонные методы
+
+template <class Visitor>
+void DirectedGraph::forEachNode(Visitor&& visitor) const
+{
+    for (size_t key = 0; key < size_; ++key)
+    {
+        if (outgoing(key)) visitor(key);
+    }
+}
+
+template <class Visitor>
+void DirectedGraph::forEachVertex(Visitor&& visitor) const
+{
+    for (size_t origin = 0; origin < size_; ++origin)
+    {
+        if (!outgoing(origin).has_value()) continue;
+
+        for (const auto& vertex : *outgoing(origin))
+        {
+            visitor(origin, vertex.weight_, vertex.destination_);
+        }
+    }
+}
+
+template <class Queue>
+ShortestPaths DirectedGraph::dijkstraPaths(size_t origin) const
+{
+    if (searchNode(origin) == false) throw std::invalid_argument("Origin node does not exist"); // Проверка на существование исходного узла
+    if (!isOnlyPositiveVertexes()) throw std::logic_error("This graph contains vertexes with negative weights, which prevents Dijkstra's algorithm from running"); // Проверка что все рёюра положительные
+
+    Queue queue; // Очередь обхода узлов
+    ShortestPaths result; // Плотные массивы расстояний и предков
+    dijkstraInto(origin, unreachable, queue, result);
+    return result;
+}
+
+template <class Queue>
+ShortestPaths DirectedGraph::reverseDijkstraPaths(size_t destination) const
+{
+    if (searchNode(destination) == false) throw std::invalid_argument("Destination node does not exist"); // Проверка на существование узла назначения
+    if (!isOnlyPositiveVertexes()) throw std::logic_error("This graph contains vertexes with negative weights, which prevents Dijkstra's algorithm from running"); // Проверка что все рёбра положительные
+
+    Queue queue; // Очередь обхода узлов
+    ShortestPaths result; // Плотные массивы расстояний и следующих узлов
+    dijkstraInto(destination, unreachable, queue, result, true);
+    return result;
+}
+
+template <class Queue>
+void DirectedGraph::dijkstraInto(size_t origin, size_t destination, Queue& queue, ShortestPaths& result, bool reverse) const
+{
+    // Инициализация расстояний
+    result.reset(origin, size_);
+    auto& distances = result.distances_;
+
+    // Установка начальных значений
+    for (size_t i = 0; i < size_; ++i) 
+    {
+        if (outgoing(i)) result.present_[i] = true;
+    }
+    queue.reset(size_);
+    distances[origin] = 0.0;
+    queue.push(0, origin);
+
+    // Основной цикл обработки узлов
+    while (!queue.empty())
+    {
+        auto [currentDist, currentNode] = queue.pop();
+
+        if (currentDist > distances[currentNode]) continue; // Устаревшая пара из очереди без уменьшения ключа
+        if (currentNode == destination) return; // Узел назначения извлечён: его расстояние окончательное
+
+        if (auto& vertexes = edges(currentNode, reverse)) 
+        {
+            // Обход всех смежных узлов
+            for (const auto& vertex : *vertexes) 
+            {
+                // Вычисление нового расстояния
+                double newDist = currentDist + vertex.weight_;
+                
+                // Обновление расстояния, если найден более короткий путь
+                if (newDist < distances[vertex.destination_]) 
+                {
+                    distances[vertex.destination_] = newDist;
+                    result.predecessors_[vertex.destination_] = currentNode;
+                    queue.push(newDist, vertex.destination_);
+                }
+            }
+        }
+    }
+}
+#endif
\ No newline at end of file
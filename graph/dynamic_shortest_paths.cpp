@@ -0,0 +1,198 @@
+#include "dynamic_shortest_paths.h"
+#include <stdexcept>
+
+// Конструктор
+
+DynamicShortestPaths::DynamicShortestPaths(DirectedGraph& graph, size_t origin):
+    graph_(graph),
+    paths_(graph.dijkstraPaths(origin))
+{
+    affectedMark_.assign(paths_.capacity(), 0);
+}
+
+// Приватные методы
+
+void DynamicShortestPaths::grow(size_t capacity)
+{
+    if (capacity <= paths_.capacity()) return;
+
+    paths_.distances_.resize(capacity, std::numeric_limits<double>::infinity());
+    paths_.predecessors_.resize(capacity, ShortestPaths::noPredecessor);
+    paths_.present_.resize(capacity, false);
+    affectedMark_.resize(capacity, 0);
+}
+
+void DynamicShortestPaths::propagate()
+{
+    auto& distances = paths_.distances_;
+
+    while (!queue_.empty())
+    {
+        auto [currentDist, currentNode] = queue_.pop();
+        if (currentDist > distances[currentNode]) continue; // Устаревшая пара
+        updatedNodes_++;
+
+        for (const auto& vertex : *graph_.outgoing(currentNode))
+        {
+            double newDist = currentDist + vertex.weight_;
+            if (newDist < distances[vertex.destination_])
+            {
+                distances[vertex.destination_] = newDist;
+                paths_.predecessors_[vertex.destination_] = currentNode;
+                queue_.push(newDist, vertex.destination_);
+            }
+        }
+    }
+}
+
+void DynamicShortestPaths::collectSubtree(size_t root)
+{
+    // Обходим дерево кратчайших путей по исходящим рёбрам: потомок — узел, предком которого является текущий
+    affected_.clear();
+    affected_.push_back(root);
+    affectedMark_[root] = update_;
+
+    for (size_t i = 0; i < affected_.size(); ++i)
+    {
+        size_t currentNode = affected_[i];
+        for (const auto& vertex : *graph_.outgoing(currentNode))
+        {
+            if (paths_.predecessors_[vertex.destination_] != currentNode || affectedMark_[vertex.destination_] == update_) continue;
+
+            affectedMark_[vertex.destination_] = update_;
+            affected_.push_back(vertex.destination_);
+        }
+    }
+}
+
+void DynamicShortestPaths::repairSubtree()
+{
+    auto& distances = paths_.distances_;
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    // Расстояния поддерева больше не действительны
+    for (size_t key : affected_)
+    {
+        distances[key] = infinity;
+        paths_.predecessors_[key] = ShortestPaths::noPredecessor;
+    }
+
+    // Начальные оценки — лучшие входящие рёбра из узлов вне поддерева (их расстояния не изменились)
+    queue_.reset(paths_.capacity());
+    for (size_t key : affected_)
+    {
+        if (!graph_.incoming(key).has_value()) continue; // Удалённый узел
+
+        for (const auto& incoming : *graph_.incoming(key))
+        {
+            if (affectedMark_[incoming.destination_] == update_) continue;
+
+            double newDist = distances[incoming.destination_] + incoming.weight_;
+            if (newDist < distances[key])
+            {
+                distances[key] = newDist;
+                paths_.predecessors_[key] = incoming.destination_;
+            }
+        }
+        if (distances[key] != infinity) queue_.push(distances[key], key);
+    }
+
+    // Уточняем расстояния внутри поддерева
+    propagate();
+    updatedNodes_ = affected_.size();
+}
+
+// Публичные методы
+
+const ShortestPaths& DynamicShortestPaths::paths() const
+{
+    return paths_;
+}
+
+double DynamicShortestPaths::distance(size_t key) const
+{
+    return paths_.distance(key);
+}
+
+size_t DynamicShortestPaths::updatedNodes() const
+{
+    return updatedNodes_;
+}
+
+void DynamicShortestPaths::insertNode(size_t key)
+{
+    graph_.insertNode(key);
+    grow(key + 1);
+    paths_.present_[key] = true; // Новый узел без рёбер недостижим
+    updatedNodes_ = 0;
+}
+
+void DynamicShortestPaths::removeNode(size_t key)
+{
+    if (graph_.searchNode(key) == false) throw std::invalid_argument("This node is not in the graph");
+    if (key == paths_.origin_) throw std::invalid_argument("The origin node cannot be removed");
+
+    // Поддерево узла собирается до удаления, пока известны его исходящие рёбра
+    update_++;
+    collectSubtree(key);
+    graph_.removeNode(key);
+    paths_.present_[key] = false;
+
+    repairSubtree();
+}
+
+void DynamicShortestPaths::addVertex(size_t origin, double weight, size_t destination)
+{
+    if (!(weight > 0)) throw std::invalid_argument("Vertex weight must be positive");
+
+    // Запоминаем прежний вес ребра (если оно было) и изменяем граф
+    const DirectedGraph::Vertex* existing = graph_.searchVertex(origin, destination);
+    bool existed = (existing != nullptr);
+    double oldWeight = existed ? existing->weight_ : 0.0;
+    graph_.addVertex(origin, weight, destination);
+
+    update_++;
+    updatedNodes_ = 0;
+    auto& distances = paths_.distances_;
+
+    if (!existed || weight < oldWeight)
+    {
+        // Новое или подешевевшее ребро может только сократить пути через узел назначения
+        if (distances[origin] + weight < distances[destination])
+        {
+            distances[destination] = distances[origin] + weight;
+            paths_.predecessors_[destination] = origin;
+            queue_.reset(paths_.capacity());
+            queue_.push(distances[destination], destination);
+            propagate();
+        }
+    }
+    else if (weight > oldWeight && paths_.predecessors_[destination] == origin)
+    {
+        // Подорожало ребро дерева: пересчитываем поддерево узла назначения
+        collectSubtree(destination);
+        repairSubtree();
+    }
+}
+
+double DynamicShortestPaths::removeVertex(size_t origin, size_t destination)
+{
+    double weight = graph_.removeVertex(origin, destination);
+
+    update_++;
+    updatedNodes_ = 0;
+    if (paths_.predecessors_[destination] == origin)
+    {
+        collectSubtree(destination);
+        repairSubtree();
+    }
+    return weight;
+}
+
+void DynamicShortestPaths::recompute()
+{
+    paths_ = graph_.dijkstraPaths(paths_.origin_);
+    affectedMark_.assign(paths_.capacity(), 0);
+    update_ = 0;
+    updatedNodes_ = graph_.size();
+}
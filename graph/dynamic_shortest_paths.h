@@ -0,0 +1,59 @@
+#ifndef DYNAMICSHORTESTPATHS_H
+#define DYNAMICSHORTESTPATHS_H
+
+#include "directed_graph.h"
+#include <vector>
+
+// Кратчайшие пути из одного узла, поддерживаемые при изменении рёбер графа (в духе Рамалингама — Репса).
+// Изменения графа выполняются через методы объекта, которые после изменения пересчитывают только затронутые узлы:
+//   вставка ребра и уменьшение веса — распространение улучшения от узла назначения алгоритмом Дейкстры;
+//   увеличение веса и удаление ребра дерева — пересчёт поддерева узла назначения по его входящим рёбрам.
+// Веса рёбер должны быть положительными. Пока объект используется, граф нельзя изменять в обход него
+class DynamicShortestPaths
+{
+public:
+    // Конструктор с параметрами: граф и исходный узел (начальный поиск выполняется алгоритмом Дейкстры)
+    DynamicShortestPaths(DirectedGraph& graph, size_t origin);
+
+    // Методы
+
+    // Получение текущих кратчайших путей
+    const ShortestPaths& paths() const;
+    // Расстояние до узла (бесконечность, если узел недостижим)
+    double distance(size_t key) const;
+    // Количество узлов, расстояние до которых пересчитывалось при последнем изменении
+    size_t updatedNodes() const;
+
+    // Добавление узла в граф
+    void insertNode(size_t key);
+    // Удаление узла из графа (исходный узел удалить нельзя)
+    void removeNode(size_t key);
+    // Добавление ребра или изменение его веса (вес должен быть положительным)
+    void addVertex(size_t origin, double weight, size_t destination);
+    // Удаление ребра
+    double removeVertex(size_t origin, size_t destination);
+
+    // Полный пересчёт путей
+    void recompute();
+
+private:
+    DirectedGraph& graph_; // Граф, пути в котором поддерживаются
+    ShortestPaths paths_; // Текущие расстояния и дерево кратчайших путей
+    BinaryHeapQueue queue_; // Очередь пересчёта (память сохраняется между изменениями)
+    std::vector<size_t> affected_; // Узлы, затронутые последним изменением
+    std::vector<size_t> affectedMark_; // Номер изменения, в котором узел попал в affected_
+    size_t update_ = 0; // Номер текущего изменения
+    size_t updatedNodes_ = 0; // Количество пересчитанных узлов при последнем изменении
+
+    // Методы
+
+    // Расширение массивов под узел с заданным номером
+    void grow(size_t capacity);
+    // Распространение уменьшения расстояния от узлов в очереди
+    void propagate();
+    // Сбор поддерева кратчайших путей с корнем root
+    void collectSubtree(size_t root);
+    // Пересчёт расстояний узлов поддерева по входящим рёбрам извне и распространение внутри него
+    void repairSubtree();
+};
+#endif
@@ -0,0 +1,211 @@
+#ifndef EDGELIST_H
+#define EDGELIST_H
+
+#include <vector>
+#include <memory_resource>
+#include <limits>
+#include <cstddef>
+
+// Список рёбер одного узла: рёбра лежат подряд в векторе, а у узлов большой степени
+// дополнительно строится хеш-индекс по номеру узла назначения (открытая адресация).
+// Память рёбер и индекса берётся из переданного источника памяти (std::pmr).
+// Vertex — структура ребра с полем destination_
+template <class Vertex>
+class EdgeList
+{
+public:
+    // Степень, начиная с которой строится хеш-индекс (ниже линейный просмотр вектора быстрее)
+    static constexpr size_t indexThreshold = 16;
+
+    using iterator = typename std::pmr::vector<Vertex>::iterator;
+    using const_iterator = typename std::pmr::vector<Vertex>::const_iterator;
+
+    // Конструктор с источником памяти
+    explicit EdgeList(std::pmr::memory_resource* resource = std::pmr::get_default_resource()):
+        edges_(resource),
+        slots_(resource)
+    {}
+
+    // Копирование списка в другой источник памяти
+    EdgeList(const EdgeList& other, std::pmr::memory_resource* resource):
+        edges_(other.edges_, resource),
+        slots_(other.slots_, resource)
+    {}
+
+    // Методы
+
+    iterator begin() { return edges_.begin(); }
+    iterator end() { return edges_.end(); }
+    const_iterator begin() const { return edges_.begin(); }
+    const_iterator end() const { return edges_.end(); }
+
+    // Получение количества рёбер
+    size_t size() const
+    {
+        return edges_.size();
+    }
+
+    // Проверка отсутствия рёбер
+    bool empty() const
+    {
+        return edges_.empty();
+    }
+
+    // Резервирование памяти под заданное число рёбер (индекс строится сразу, если он понадобится)
+    void reserve(size_t count)
+    {
+        edges_.reserve(count);
+        if (count > indexThreshold && slots_.size() < indexCapacity(count)) rebuildIndex(indexCapacity(count));
+    }
+
+    // Удаление всех рёбер
+    void clear()
+    {
+        edges_.clear();
+        slots_.clear();
+    }
+
+    // Поиск ребра до заданного узла (nullptr, если ребра нет)
+    Vertex* find(size_t destination)
+    {
+        size_t position = findPosition(destination);
+        return (position == npos) ? nullptr : &edges_[position];
+    }
+
+    const Vertex* find(size_t destination) const
+    {
+        size_t position = findPosition(destination);
+        return (position == npos) ? nullptr : &edges_[position];
+    }
+
+    // Добавление ребра (ребра до этого узла в списке быть не должно)
+    void insert(const Vertex& vertex)
+    {
+        edges_.push_back(vertex);
+
+        if (!slots_.empty())
+        {
+            // Поддерживаем заполнение индекса не выше половины
+            if (edges_.size() * 2 > slots_.size()) rebuildIndex(slots_.size() * 2);
+            else slots_[freeSlot(vertex.destination_)] = edges_.size();
+        }
+        else if (edges_.size() > indexThreshold) rebuildIndex(indexCapacity(edges_.size()));
+    }
+
+    // Удаление ребра до заданного узла (false, если ребра нет). На его место переносится последнее ребро
+    bool erase(size_t destination)
+    {
+        if (slots_.empty())
+        {
+            size_t position = findPosition(destination);
+            if (position == npos) return false;
+
+            edges_[position] = edges_.back();
+            edges_.pop_back();
+            return true;
+        }
+
+        size_t slot = findSlot(destination);
+        if (slot == npos) return false;
+
+        size_t position = slots_[slot] - 1;
+        removeSlot(slot);
+
+        // Переносим последнее ребро на освободившееся место и исправляем его ячейку в индексе
+        size_t last = edges_.size() - 1;
+        if (position != last)
+        {
+            slots_[findSlot(edges_[last].destination_)] = position + 1;
+            edges_[position] = edges_[last];
+        }
+        edges_.pop_back();
+
+        // У узла стало мало рёбер — индекс больше не нужен
+        if (edges_.size() * 2 < indexThreshold) slots_.clear();
+        return true;
+    }
+
+private:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max(); // Ребро не найдено
+
+    std::pmr::vector<Vertex> edges_; // Рёбра узла
+    std::pmr::vector<size_t> slots_; // Хеш-индекс: номер ребра + 1 (0 — пустая ячейка); пуст у узлов малой степени
+
+    // Вместимость индекса: степень двойки, не меньше удвоенного числа рёбер
+    static size_t indexCapacity(size_t count)
+    {
+        size_t capacity = 1;
+        while (capacity < count * 2) capacity <<= 1;
+        return capacity;
+    }
+
+    // Начальная ячейка для узла назначения
+    size_t home(size_t destination) const
+    {
+        return (destination * 0x9E3779B97F4A7C15ull >> 20) & (slots_.size() - 1);
+    }
+
+    // Первая свободная ячейка в цепочке узла назначения
+    size_t freeSlot(size_t destination) const
+    {
+        size_t slot = home(destination);
+        while (slots_[slot] != 0) slot = (slot + 1) & (slots_.size() - 1);
+        return slot;
+    }
+
+    // Ячейка индекса, указывающая на ребро до узла (npos, если ребра нет)
+    size_t findSlot(size_t destination) const
+    {
+        for (size_t slot = home(destination); slots_[slot] != 0; slot = (slot + 1) & (slots_.size() - 1))
+        {
+            if (edges_[slots_[slot] - 1].destination_ == destination) return slot;
+        }
+        return npos;
+    }
+
+    // Номер ребра до узла (npos, если ребра нет)
+    size_t findPosition(size_t destination) const
+    {
+        if (!slots_.empty())
+        {
+            size_t slot = findSlot(destination);
+            return (slot == npos) ? npos : slots_[slot] - 1;
+        }
+
+        for (size_t position = 0; position < edges_.size(); ++position)
+        {
+            if (edges_[position].destination_ == destination) return position;
+        }
+        return npos;
+    }
+
+    // Перестроение индекса с заданной вместимостью
+    void rebuildIndex(size_t capacity)
+    {
+        slots_.assign(capacity, 0);
+        for (size_t position = 0; position < edges_.size(); ++position)
+        {
+            slots_[freeSlot(edges_[position].destination_)] = position + 1;
+        }
+    }
+
+    // Освобождение ячейки со сдвигом следующих элементов цепочки назад
+    void removeSlot(size_t slot)
+    {
+        const size_t mask = slots_.size() - 1;
+        slots_[slot] = 0;
+
+        for (size_t next = (slot + 1) & mask; slots_[next] != 0; next = (next + 1) & mask)
+        {
+            // Элемент можно сдвинуть в освободившуюся ячейку, если она лежит между его начальной ячейкой и текущей
+            size_t start = home(edges_[slots_[next] - 1].destination_);
+            if (((next - start) & mask) >= ((next - slot) & mask))
+            {
+                slots_[slot] = slots_[next];
+                slots_[next] = 0;
+                slot = next;
+            }
+        }
+    }
+};
+#endif
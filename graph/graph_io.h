@@ -2,6 +2,8 @@
 #define GRAPH_IO_H
 
 #include "directed_graph.h"
+#include "graph_loader.h"
+#include "graph_writer.h"
 #include <fstream>
 #include <string>
 #include <sstream>
@@ -97,37 +99,68 @@ std::istream& operator>>(std::istream& in, DirectedGraph& graph)
     return in;
 }
 
-// Функция для чтения данных из файла в граф
-bool readData(std::string fileName, DirectedGraph& graph)
+// Функция для потокового чтения рёбер (например, из канала) с выводом ошибок каждого пакета
+bool readStream(std::istream& in, DirectedGraph& graph)
 {
-    // Открываем файл
-    std::ifstream file(fileName);
-    if (!file.is_open())
+    StreamLoader loader(graph);
+    try
     {
-        std::cerr << "\033[31mError: Failed to open file\033[0m" << "\n";
+        loader.ingest(in, [](const BatchStats& batch)
+        {
+            for (const auto& error : batch.errors)
+            {
+                std::cerr << "\033[31mWarning: line " << error.line << ": " << error.message << "\033[0m\n";
+            }
+            if (batch.malformed + batch.skipped > batch.errors.size())
+            {
+                std::cerr << "\033[31mWarning: " << batch.malformed + batch.skipped - batch.errors.size() << " more errors in batch " << batch.batch << "\033[0m\n";
+            }
+        });
+    }
+    catch (const std::runtime_error& e)
+    {
+        std::cerr << "\033[31mError: " << e.what() << "\033[0m" << "\n";
         return false;
     }
+    return true;
+}
 
-    std::string line; // Строка, считанная из файла
-
-    // Считываем данные из файла
-    while(std::getline(file, line))
+// Функция для чтения данных из файла в граф (файл отображается в память и разбирается параллельно)
+bool readData(std::string fileName, DirectedGraph& graph)
+{
+    // Загружаем все рёбра файла одним пакетом
+    try
+    {
+        loadGraph(fileName, graph);
+    }
+    catch (const std::runtime_error& e)
     {
-        std::istringstream iss(line);
-        iss >> graph;
+        std::cerr << "\033[31mError: " << e.what() << "\033[0m" << "\n";
+        return false;
     }
 
     // Проверяем правильно ли считался файл
-    if (file.bad() || (graph.size() == 0)) 
+    if (graph.size() == 0) 
     {
         std::cerr << "\033[31mWarning: File read error occurred.\033[0m\n";
-        file.close();
         return false;
     }
 
-    // Закрываем файл
-    file.close();
+    return true;
+}
 
+// Функция для записи графа в файл (по умолчанию в формате, который читает readData)
+bool writeData(std::string fileName, const DirectedGraph& graph, GraphFormat format = GraphFormat::Text)
+{
+    try
+    {
+        saveGraph(fileName, graph, format);
+    }
+    catch (const std::runtime_error& e)
+    {
+        std::cerr << "\033[31mError: " << e.what() << "\033[0m" << "\n";
+        return false;
+    }
     return true;
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,285 @@
+#include "graph_loader.h"
+#include "thread_pool.h"
+#include "mapped_file.h"
+#include <charconv>
+#include <algorithm>
+#include <thread>
+#include <cstring>
+#include <chrono>
+#include <stdexcept>
+#include <sys/mman.h>
+
+namespace
+{
+    // Минимальный размер части текста, которую имеет смысл отдавать отдельному потоку
+    constexpr size_t minimalChunk = 1 << 20;
+
+    // Пропуск пробельных символов (как при чтении из потока)
+    const char* skipSpaces(const char* first, const char* last)
+    {
+        while (first != last && (*first == ' ' || *first == '\t' || *first == '\r' || *first == '\v' || *first == '\f')) ++first;
+        return first;
+    }
+
+    // Чтение ожидаемого символа-разделителя
+    bool readDelimiter(const char*& first, const char* last, char expected)
+    {
+        first = skipSpaces(first, last);
+        if (first == last || *first != expected) return false;
+        ++first;
+        return true;
+    }
+
+    // Чтение числа (знак '+' допускается, как при чтении из потока)
+    template <class T>
+    bool readNumber(const char*& first, const char* last, T& value)
+    {
+        first = skipSpaces(first, last);
+        if (first != last && *first == '+') ++first;
+
+        auto result = std::from_chars(first, last, value);
+        if (result.ec != std::errc()) return false;
+        first = result.ptr;
+        return true;
+    }
+
+    // Разбор строк, начинающихся в [begin, end) (последняя строка может выходить за end)
+    void parseChunk(const char* begin, const char* end, const char* last, std::vector<DirectedGraph::VertexRecord>& vertexes, LoadStats& stats)
+    {
+        vertexes.reserve((end - begin) / 16); // Оценка числа строк: короткая запись ребра занимает около 16 байт
+
+        const char* line = begin;
+        while (line < end)
+        {
+            const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', last - line));
+            if (lineEnd == nullptr) lineEnd = last;
+
+            DirectedGraph::VertexRecord record;
+            if (parseVertex(line, lineEnd, record)) vertexes.push_back(record);
+            else stats.malformed++;
+            stats.lines++;
+
+            line = lineEnd + 1;
+        }
+        stats.vertexes = vertexes.size();
+    }
+}
+
+bool parseVertex(const char* first, const char* last, DirectedGraph::VertexRecord& record)
+{
+    return readDelimiter(first, last, '(') && readNumber(first, last, record.origin) &&
+        readDelimiter(first, last, ',') && readNumber(first, last, record.weight) &&
+        readDelimiter(first, last, ',') && readNumber(first, last, record.destination) &&
+        readDelimiter(first, last, ')');
+}
+
+void parseVertexes(const char* data, size_t size, std::vector<DirectedGraph::VertexRecord>& vertexes, LoadStats& stats, size_t threads)
+{
+    if (size == 0) return;
+    const char* last = data + size;
+
+    // Ограничиваем число частей, чтобы каждая была не меньше minimalChunk (небольшие файлы разбираются без потоков)
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t parts = std::min(threads, size / minimalChunk + 1);
+    ThreadPool pool(parts);
+
+    // Границы частей сдвигаются на начало следующей строки
+    std::vector<const char*> bounds(parts + 1, last);
+    bounds[0] = data;
+    for (size_t part = 1; part < parts; ++part)
+    {
+        const char* bound = std::max(data + size * part / parts, bounds[part - 1]);
+        if (bound != data && bound[-1] != '\n')
+        {
+            const char* lineEnd = static_cast<const char*>(std::memchr(bound, '\n', last - bound));
+            bound = (lineEnd == nullptr) ? last : lineEnd + 1;
+        }
+        bounds[part] = bound;
+    }
+
+    // Разбираем части параллельно в отдельные буферы
+    std::vector<std::vector<DirectedGraph::VertexRecord>> partVertexes(parts);
+    std::vector<LoadStats> partStats(parts);
+    pool.parallelFor(parts, [&](size_t, size_t begin, size_t end)
+    {
+        for (size_t part = begin; part < end; ++part)
+        {
+            parseChunk(bounds[part], bounds[part + 1], last, partVertexes[part], partStats[part]);
+        }
+    });
+
+    // Склеиваем результаты в порядке строк
+    size_t total = vertexes.size();
+    for (const auto& part : partVertexes) total += part.size();
+    vertexes.reserve(total);
+    for (size_t part = 0; part < parts; ++part)
+    {
+        vertexes.insert(vertexes.end(), partVertexes[part].begin(), partVertexes[part].end());
+        stats.lines += partStats[part].lines;
+        stats.vertexes += partStats[part].vertexes;
+        stats.malformed += partStats[part].malformed;
+    }
+}
+
+LoadStats loadGraph(const std::string& fileName, DirectedGraph& graph, size_t threads)
+{
+    MappedFile file(fileName);
+    if (file.size() != 0) ::madvise(const_cast<char*>(file.data()), file.size(), MADV_SEQUENTIAL); // Файл читается один раз подряд
+
+    LoadStats stats;
+    std::vector<DirectedGraph::VertexRecord> vertexes;
+    parseVertexes(file.data(), file.size(), vertexes, stats, threads);
+
+    stats.skipped = graph.addVertexes(vertexes);
+    return stats;
+}
+
+// Потоковая загрузка
+
+StreamLoader::StreamLoader(DirectedGraph& graph, size_t bufferSize):
+    graph_(graph),
+    buffer_(std::max<size_t>(bufferSize, 64))
+{
+    // Самая короткая строка "(0,0,0)\n" занимает 8 байт — больше рёбер в пакете не поместится
+    vertexes_.reserve(buffer_.size() / 8);
+    vertexLines_.reserve(buffer_.size() / 8);
+}
+
+void StreamLoader::addError(BatchStats& batch, size_t line, const char* message)
+{
+    if (batch.errors.size() < maxBatchErrors) batch.errors.push_back(IngestError{line, message});
+}
+
+void StreamLoader::parseLine(const char* first, const char* last, BatchStats& batch)
+{
+    lines_++;
+    batch.lines++;
+
+    DirectedGraph::VertexRecord record;
+    if (parseVertex(first, last, record))
+    {
+        vertexes_.push_back(record);
+        vertexLines_.push_back(lines_);
+    }
+    else
+    {
+        batch.malformed++;
+        addError(batch, lines_, "Line does not match the (origin, weight, destination) format");
+    }
+}
+
+size_t StreamLoader::readAvailable(std::istream& in, size_t filled)
+{
+    size_t read = 0;
+    while (filled + read < buffer_.size())
+    {
+        std::streamsize got = in.readsome(buffer_.data() + filled + read, buffer_.size() - filled - read);
+        if (got <= 0) break;
+        read += static_cast<size_t>(got);
+    }
+    return read;
+}
+
+LoadStats StreamLoader::ingest(std::istream& in, const Callback& callback)
+{
+    LoadStats total;
+    size_t filled = 0; // Незавершённая строка, перенесённая в начало буфера
+    bool skipping = false; // Пропуск остатка строки, не поместившейся в буфер
+    bool finished = false;
+
+    while (!finished)
+    {
+        // Забираем то, что поток отдаёт без ожидания, поэтому пакет не ждёт заполнения буфера
+        size_t read = readAvailable(in, filled);
+        if (read == 0)
+        {
+            // Готовых данных нет: ждём следующий символ или конец потока
+            finished = std::istream::traits_type::eq_int_type(in.peek(), std::istream::traits_type::eof());
+            if (in.bad()) throw std::runtime_error("Stream read error");
+            if (!finished)
+            {
+                read = readAvailable(in, filled);
+                if (read == 0)
+                {
+                    // Поток без буфера чтения отдаёт символы только по одному
+                    in.read(buffer_.data() + filled, 1);
+                    read = static_cast<size_t>(in.gcount());
+                }
+            }
+        }
+        if (in.bad()) throw std::runtime_error("Stream read error");
+        filled += read;
+
+        auto started = std::chrono::steady_clock::now();
+        BatchStats batch;
+        batch.batch = batches_;
+        batch.bytes = read;
+        vertexes_.clear();
+        vertexLines_.clear();
+
+        const char* line = buffer_.data();
+        const char* last = buffer_.data() + filled;
+
+        // Дочитываем слишком длинную строку до её конца
+        if (skipping)
+        {
+            const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', last - line));
+            if (lineEnd == nullptr) line = last;
+            else
+            {
+                line = lineEnd + 1;
+                skipping = false;
+            }
+        }
+
+        // Разбираем завершённые строки (в конце потока — и последнюю строку без перевода строки)
+        while (line < last)
+        {
+            const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', last - line));
+            if (lineEnd == nullptr)
+            {
+                if (!finished) break;
+                lineEnd = last;
+            }
+            parseLine(line, lineEnd, batch);
+            line = std::min(lineEnd + 1, last);
+        }
+
+        // Переносим незавершённую строку в начало буфера
+        size_t tail = last - line;
+        if (tail == buffer_.size())
+        {
+            // Строка не помещается в буфер: считаем её ошибочной и пропускаем до конца
+            lines_++;
+            batch.lines++;
+            batch.malformed++;
+            addError(batch, lines_, "Line is longer than the stream buffer");
+            skipping = true;
+            tail = 0;
+        }
+        std::memmove(buffer_.data(), line, tail);
+        filled = tail;
+
+        // Добавляем пакет в граф
+        skippedIndexes_.clear();
+        batch.vertexes = vertexes_.size();
+        batch.skipped = graph_.addVertexes(vertexes_, &skippedIndexes_);
+        for (size_t index : skippedIndexes_)
+        {
+            addError(batch, vertexLines_[index], "Reverse vertex already exists between these nodes");
+        }
+        std::sort(batch.errors.begin(), batch.errors.end(), [](const IngestError& left, const IngestError& right) { return left.line < right.line; });
+        batch.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+        total.lines += batch.lines;
+        total.vertexes += batch.vertexes;
+        total.malformed += batch.malformed;
+        total.skipped += batch.skipped;
+
+        if (batch.bytes == 0 && batch.lines == 0) continue; // Пустое чтение в конце потока
+        batches_++;
+        if (callback) callback(batch);
+    }
+
+    return total;
+}
@@ -0,0 +1,98 @@
+#ifndef GRAPHLOADER_H
+#define GRAPHLOADER_H
+
+#include "directed_graph.h"
+#include <string>
+#include <vector>
+#include <istream>
+#include <functional>
+
+// Статистика загрузки рёбер
+struct LoadStats
+{
+    size_t lines = 0; // Количество прочитанных строк
+    size_t vertexes = 0; // Количество разобранных рёбер
+    size_t malformed = 0; // Количество строк, не соответствующих формату "(origin, weight, destination)"
+    size_t skipped = 0; // Количество рёбер, отклонённых графом (обратные к существующим)
+};
+
+// Ошибка в строке входных данных
+struct IngestError
+{
+    size_t line; // Номер строки (с единицы)
+    std::string message; // Описание ошибки
+};
+
+// Статистика одного пакета потоковой загрузки
+struct BatchStats
+{
+    size_t batch = 0; // Номер пакета (с нуля)
+    size_t bytes = 0; // Объём прочитанных данных
+    size_t lines = 0; // Количество завершённых строк
+    size_t vertexes = 0; // Количество разобранных рёбер
+    size_t malformed = 0; // Количество строк, не соответствующих формату
+    size_t skipped = 0; // Количество рёбер, отклонённых графом
+    double seconds = 0.0; // Время разбора и добавления пакета
+    std::vector<IngestError> errors; // Первые ошибки пакета (не более StreamLoader::maxBatchErrors)
+
+    // Пропускная способность пакета (строк в секунду)
+    double linesPerSecond() const
+    {
+        return (seconds > 0.0) ? lines / seconds : 0.0;
+    }
+};
+
+// Потоковая загрузка рёбер из любого std::istream (файл, канал, сетевой поток).
+// Данные читаются в буфер фиксированного размера: пакет составляют завершённые строки из всего, что поток
+// отдаёт без ожидания (но не больше буфера), и он сразу добавляется в граф. Поток ожидается, только
+// когда готовых данных нет, поэтому медленный источник получает пакеты по мере поступления строк,
+// а память не зависит от объёма потока. Строки длиннее буфера считаются ошибочными
+class StreamLoader
+{
+public:
+    // Обработчик статистики пакета
+    using Callback = std::function<void(const BatchStats&)>;
+
+    // Наибольшее число ошибок, сохраняемых в статистике одного пакета
+    static constexpr size_t maxBatchErrors = 16;
+
+    // Конструктор с параметрами: граф-приёмник и размер буфера в байтах
+    explicit StreamLoader(DirectedGraph& graph, size_t bufferSize = 1 << 20);
+
+    // Методы
+
+    // Чтение потока до конца; callback вызывается после каждого пакета.
+    // Выбрасывает std::runtime_error при ошибке чтения потока (уже добавленные пакеты остаются в графе)
+    LoadStats ingest(std::istream& in, const Callback& callback = nullptr);
+
+private:
+    DirectedGraph& graph_; // Граф, в который добавляются рёбра
+    std::vector<char> buffer_; // Буфер чтения
+    std::vector<DirectedGraph::VertexRecord> vertexes_; // Рёбра текущего пакета
+    std::vector<size_t> vertexLines_; // Номера строк рёбер текущего пакета
+    std::vector<size_t> skippedIndexes_; // Номера отклонённых графом рёбер пакета
+    size_t lines_ = 0; // Количество строк, прочитанных за всё время
+    size_t batches_ = 0; // Количество обработанных пакетов
+
+    // Методы
+
+    // Чтение в буфер после filled байт всего, что поток отдаёт без ожидания; возвращает число прочитанных байт
+    size_t readAvailable(std::istream& in, size_t filled);
+    // Разбор одной строки в текущий пакет
+    void parseLine(const char* first, const char* last, BatchStats& batch);
+    // Добавление ошибки в статистику пакета
+    static void addError(BatchStats& batch, size_t line, const char* message);
+};
+
+// Разбор одной строки формата "(origin, weight, destination)" в диапазоне [first, last)
+bool parseVertex(const char* first, const char* last, DirectedGraph::VertexRecord& record);
+
+// Разбор текста рёбер по строкам (некорректные строки пропускаются).
+// Текст делится на части по границам строк и разбирается threads потоками (0 — по числу ядер);
+// порядок записей совпадает с порядком строк
+void parseVertexes(const char* data, size_t size, std::vector<DirectedGraph::VertexRecord>& vertexes, LoadStats& stats, size_t threads = 0);
+
+// Загрузка рёбер из файла в граф: файл отображается в память, разбирается параллельно
+// и добавляется одним пакетом. Выбрасывает std::runtime_error, если файл не удалось открыть
+LoadStats loadGraph(const std::string& fileName, DirectedGraph& graph, size_t threads = 0);
+#endif
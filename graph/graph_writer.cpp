@@ -0,0 +1,154 @@
+#include "graph_writer.h"
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+    // Буфер вывода: записи формируются прямо в нём и сбрасываются в поток крупными блоками
+    class OutputBuffer
+    {
+    public:
+        // Наибольшая длина одной записи (два числа size_t, число double и разделители)
+        static constexpr size_t maxRecord = 128;
+
+        explicit OutputBuffer(std::ostream& out):
+            out_(out),
+            buffer_(1 << 16)
+        {}
+
+        OutputBuffer(const OutputBuffer&) = delete;
+        OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+        ~OutputBuffer()
+        {
+            flush();
+        }
+
+        // Гарантия места под очередную запись
+        void reserve()
+        {
+            if (used_ + maxRecord > buffer_.size()) flush();
+        }
+
+        void put(char symbol)
+        {
+            buffer_[used_++] = symbol;
+        }
+
+        void put(const char* text)
+        {
+            while (*text != '\0') buffer_[used_++] = *text++;
+        }
+
+        template <class T>
+        void putNumber(T value)
+        {
+            auto result = std::to_chars(buffer_.data() + used_, buffer_.data() + buffer_.size(), value);
+            used_ = result.ptr - buffer_.data();
+        }
+
+        void flush()
+        {
+            out_.write(buffer_.data(), used_);
+            used_ = 0;
+        }
+
+    private:
+        std::ostream& out_; // Поток вывода
+        std::vector<char> buffer_; // Буфер записей
+        size_t used_ = 0; // Заполненная часть буфера
+    };
+
+    void writeText(OutputBuffer& buffer, const DirectedGraph& graph)
+    {
+        graph.forEachVertex([&buffer](size_t origin, double weight, size_t destination)
+        {
+            buffer.reserve();
+            buffer.put('(');
+            buffer.putNumber(origin);
+            buffer.put(", ");
+            buffer.putNumber(weight);
+            buffer.put(", ");
+            buffer.putNumber(destination);
+            buffer.put(")\n");
+        });
+    }
+
+    void writeEdgeList(OutputBuffer& buffer, const DirectedGraph& graph)
+    {
+        graph.forEachVertex([&buffer](size_t origin, double weight, size_t destination)
+        {
+            buffer.reserve();
+            buffer.putNumber(origin);
+            buffer.put(' ');
+            buffer.putNumber(destination);
+            buffer.put(' ');
+            buffer.putNumber(weight);
+            buffer.put('\n');
+        });
+    }
+
+    void writeDot(OutputBuffer& buffer, const DirectedGraph& graph)
+    {
+        buffer.put("digraph G {\n");
+
+        // Узлы перечисляются отдельно, чтобы не потерять узлы без рёбер
+        graph.forEachNode([&buffer](size_t key)
+        {
+            buffer.reserve();
+            buffer.put("  ");
+            buffer.putNumber(key);
+            buffer.put(";\n");
+        });
+        graph.forEachVertex([&buffer](size_t origin, double weight, size_t destination)
+        {
+            buffer.reserve();
+            buffer.put("  ");
+            buffer.putNumber(origin);
+            buffer.put(" -> ");
+            buffer.putNumber(destination);
+            buffer.put(" [label=\"");
+            buffer.putNumber(weight);
+            buffer.put("\"];\n");
+        });
+
+        buffer.reserve();
+        buffer.put("}\n");
+    }
+}
+
+void writeGraph(std::ostream& out, const DirectedGraph& graph, GraphFormat format)
+{
+    if (format == GraphFormat::Binary)
+    {
+        CompressedGraph::writeSnapshot(out, graph);
+        return;
+    }
+
+    OutputBuffer buffer(out);
+    switch (format)
+    {
+        case GraphFormat::Text:
+            writeText(buffer, graph);
+            break;
+        case GraphFormat::EdgeList:
+            writeEdgeList(buffer, graph);
+            break;
+        case GraphFormat::Dot:
+            writeDot(buffer, graph);
+            break;
+        case GraphFormat::Binary:
+            break;
+    }
+}
+
+void saveGraph(const std::string& fileName, const DirectedGraph& graph, GraphFormat format)
+{
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) throw std::runtime_error("Failed to open file");
+
+    writeGraph(file, graph, format);
+    file.flush();
+    if (!file) throw std::runtime_error("Failed to write file");
+}
@@ -0,0 +1,24 @@
+#ifndef GRAPHWRITER_H
+#define GRAPHWRITER_H
+
+#include "directed_graph.h"
+#include <ostream>
+#include <string>
+
+// Форматы вывода графа
+enum class GraphFormat
+{
+    Text, // Строки "(origin, weight, destination)", читаемые readData (узлы без рёбер не сохраняются)
+    EdgeList, // Строки "origin destination weight"
+    Dot, // Описание для Graphviz (вес ребра — подпись)
+    Binary // Двоичный CSR-снимок, открываемый CompressedGraph::load
+};
+
+// Запись графа в поток в заданном формате. Текстовые форматы формируются в буфере
+// без промежуточных строк на каждое ребро; веса записываются в кратчайшем точном виде.
+// Двоичный снимок записывается по узлам, без построения массивов CSR в памяти
+void writeGraph(std::ostream& out, const DirectedGraph& graph, GraphFormat format = GraphFormat::Text);
+
+// Запись графа в файл в заданном формате. Выбрасывает std::runtime_error при ошибке записи
+void saveGraph(const std::string& fileName, const DirectedGraph& graph, GraphFormat format = GraphFormat::Text);
+#endif
@@ -0,0 +1,197 @@
+#include "landmarks.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+    // Рёбра графа без учёта направления в формате CSR: по ним измеряется удалённость узлов при выборе ориентиров
+    // (в графе без встречных рёбер многие пары узлов друг из друга недостижимы, хотя и лежат рядом)
+    class UndirectedEdges
+    {
+    public:
+        UndirectedEdges(const DirectedGraph& graph, size_t capacity):
+            offsets_(capacity + 1, 0)
+        {
+            graph.forEachVertex([&](size_t origin, double weight, size_t destination)
+            {
+                if (weight <= 0) throw std::logic_error("This graph contains vertexes with negative weights, which prevents Dijkstra's algorithm from running");
+                offsets_[origin + 1]++;
+                offsets_[destination + 1]++;
+            });
+            for (size_t key = 0; key < capacity; ++key)
+            {
+                offsets_[key + 1] += offsets_[key];
+            }
+
+            targets_.resize(offsets_[capacity]);
+            weights_.resize(offsets_[capacity]);
+            std::vector<size_t> next(offsets_.begin(), offsets_.end() - 1);
+            graph.forEachVertex([&](size_t origin, double weight, size_t destination)
+            {
+                targets_[next[origin]] = destination;
+                weights_[next[origin]++] = weight;
+                targets_[next[destination]] = origin;
+                weights_[next[destination]++] = weight;
+            });
+        }
+
+        // Алгоритм Дейкстры из узла source
+        void distancesFrom(size_t source, std::vector<double>& distances, BinaryHeapQueue& queue) const
+        {
+            distances.assign(offsets_.size() - 1, std::numeric_limits<double>::infinity());
+            distances[source] = 0.0;
+            queue.reset(distances.size());
+            queue.push(0.0, source);
+
+            while (!queue.empty())
+            {
+                auto [currentDist, currentNode] = queue.pop();
+                if (currentDist > distances[currentNode]) continue;
+
+                for (size_t edge = offsets_[currentNode]; edge < offsets_[currentNode + 1]; ++edge)
+                {
+                    double newDist = currentDist + weights_[edge];
+                    if (newDist < distances[targets_[edge]])
+                    {
+                        distances[targets_[edge]] = newDist;
+                        queue.push(newDist, targets_[edge]);
+                    }
+                }
+            }
+        }
+
+    private:
+        std::vector<size_t> offsets_; // Начало рёбер каждого узла
+        std::vector<size_t> targets_; // Соседи узлов подряд
+        std::vector<double> weights_; // Веса рёбер подряд
+    };
+}
+
+LandmarkIndex::LandmarkIndex(const DirectedGraph& graph, size_t count):
+    version_(graph.version())
+{
+    if (count == 0) throw std::invalid_argument("Landmark count must be positive");
+
+    std::vector<size_t> nodes;
+    graph.forEachNode([&](size_t key) { nodes.push_back(key); });
+    if (nodes.empty()) return;
+
+    size_t capacity = nodes.back() + 1;
+    count = std::min(count, nodes.size());
+    present_.assign(capacity, false);
+    for (size_t key : nodes) present_[key] = true;
+    from_.assign(capacity * count, std::numeric_limits<double>::infinity());
+    to_.assign(capacity * count, std::numeric_limits<double>::infinity());
+
+    // Удалённость узла от выбранных ориентиров: минимум расстояний без учёта направления рёбер.
+    // Начальные значения даёт первый узел графа, но ориентиром он не становится
+    UndirectedEdges undirected(graph, capacity);
+    BinaryHeapQueue queue;
+    std::vector<double> distances;
+    std::vector<double> separation(capacity, std::numeric_limits<double>::infinity());
+    std::vector<bool> chosen(capacity, false);
+    auto separate = [&](size_t source)
+    {
+        undirected.distancesFrom(source, distances, queue);
+        for (size_t key : nodes)
+        {
+            separation[key] = std::min(separation[key], distances[key]);
+        }
+    };
+    separate(nodes.front());
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        // Следующий ориентир — самый удалённый из остальных узлов (узлы других компонент связности в первую очередь)
+        size_t best = DirectedGraph::unreachable;
+        for (size_t key : nodes)
+        {
+            if (chosen[key]) continue;
+            if (best == DirectedGraph::unreachable || separation[key] > separation[best]) best = key;
+        }
+        landmarks_.push_back(best);
+        chosen[best] = true;
+
+        ShortestPaths forward = graph.dijkstraPaths(best);
+        ShortestPaths backward = graph.reverseDijkstraPaths(best);
+        for (size_t key : nodes)
+        {
+            from_[key * count + i] = forward.distance(key);
+            to_[key * count + i] = backward.distance(key);
+        }
+        separate(best);
+    }
+}
+
+// Приватные методы
+
+bool LandmarkIndex::contains(size_t key) const
+{
+    return (key < present_.size()) && present_[key];
+}
+
+double LandmarkIndex::bound(size_t node, size_t destination) const
+{
+    const double infinity = std::numeric_limits<double>::infinity();
+    size_t count = landmarks_.size();
+    const double* nodeFrom = &from_[node * count];
+    const double* nodeTo = &to_[node * count];
+    const double* destinationFrom = &from_[destination * count];
+    const double* destinationTo = &to_[destination * count];
+
+    double result = 0.0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        // d(v, t) >= d(L, t) - d(L, v); если L достигает v, но не t, то и из v узел t недостижим
+        if (nodeFrom[i] != infinity)
+        {
+            if (destinationFrom[i] == infinity) return infinity;
+            result = std::max(result, destinationFrom[i] - nodeFrom[i]);
+        }
+
+        // d(v, t) >= d(v, L) - d(t, L); если из t достижим L, а из v нет, то из v недостижим и t
+        if (destinationTo[i] != infinity)
+        {
+            if (nodeTo[i] == infinity) return infinity;
+            result = std::max(result, nodeTo[i] - destinationTo[i]);
+        }
+    }
+    return result;
+}
+
+// Публичные методы
+
+const std::vector<size_t>& LandmarkIndex::landmarks() const
+{
+    return landmarks_;
+}
+
+bool LandmarkIndex::isCurrent(const DirectedGraph& graph) const
+{
+    return graph.version() == version_;
+}
+
+double LandmarkIndex::lowerBound(size_t node, size_t destination) const
+{
+    if (contains(node) == false) throw std::invalid_argument("This node is not in the landmark index");
+    if (contains(destination) == false) throw std::invalid_argument("Destination node is not in the landmark index");
+    return bound(node, destination);
+}
+
+DirectedGraph::Heuristic LandmarkIndex::heuristic(size_t destination) const
+{
+    if (contains(destination) == false) throw std::invalid_argument("Destination node is not in the landmark index");
+
+    // Для узлов, которых не было при построении, оценка нулевая (всегда допустимая)
+    return [this, destination](size_t node)
+    {
+        return contains(node) ? bound(node, destination) : 0.0;
+    };
+}
+
+double LandmarkIndex::shortestPath(const DirectedGraph& graph, size_t origin, size_t destination, size_t* settledNodes) const
+{
+    if (!isCurrent(graph)) throw std::logic_error("Landmark index is out of date");
+    return graph.aStar(origin, destination, heuristic(destination), settledNodes);
+}
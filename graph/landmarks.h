@@ -0,0 +1,48 @@
+#ifndef LANDMARKS_H
+#define LANDMARKS_H
+
+#include "directed_graph.h"
+#include <vector>
+#include <cstddef>
+
+// Предобработка ALT (A*, ориентиры, неравенство треугольника) для запросов A*.
+// Для каждого ориентира L хранятся расстояния d(L, v) и d(v, L) до всех узлов; из неравенства треугольника
+// d(v, t) >= max(d(L, t) - d(L, v), d(v, L) - d(t, L)), что даёт допустимую эвристику.
+// Ориентиры выбираются жадно: каждый следующий — самый удалённый от уже выбранных
+class LandmarkIndex
+{
+public:
+    // Конструктор с параметрами: граф и число ориентиров (не больше числа узлов).
+    // Выбрасывает std::invalid_argument при count == 0 и std::logic_error, если в графе есть неположительные веса
+    LandmarkIndex(const DirectedGraph& graph, size_t count);
+
+    // Методы
+
+    // Получение выбранных ориентиров
+    const std::vector<size_t>& landmarks() const;
+    // Проверка, построен ли индекс для текущего содержимого графа
+    bool isCurrent(const DirectedGraph& graph) const;
+
+    // Нижняя оценка расстояния от узла до узла назначения (бесконечность, если путь точно не существует)
+    double lowerBound(size_t node, size_t destination) const;
+    // Эвристика A* к заданному узлу назначения (индекс должен существовать, пока используется эвристика)
+    DirectedGraph::Heuristic heuristic(size_t destination) const;
+    // Кратчайший путь A* с оценками ориентиров. Выбрасывает std::logic_error,
+    // если граф изменился после построения индекса (оценки могли стать недопустимыми)
+    double shortestPath(const DirectedGraph& graph, size_t origin, size_t destination, size_t* settledNodes = nullptr) const;
+
+private:
+    std::vector<size_t> landmarks_; // Ориентиры
+    std::vector<double> from_; // Расстояния от ориентиров: from_[node * count + i] = d(landmarks_[i], node)
+    std::vector<double> to_; // Расстояния до ориентиров: to_[node * count + i] = d(node, landmarks_[i])
+    std::vector<bool> present_; // Битовая карта узлов, существовавших на момент построения
+    size_t version_; // Версия графа на момент построения
+
+    // Методы
+
+    // Проверка, существовал ли узел в графе на момент построения
+    bool contains(size_t key) const;
+    // Нижняя оценка без проверки узлов
+    double bound(size_t node, size_t destination) const;
+};
+#endif
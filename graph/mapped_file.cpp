@@ -0,0 +1,47 @@
+#include "mapped_file.h"
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string& fileName)
+{
+    int descriptor = ::open(fileName.c_str(), O_RDONLY);
+    if (descriptor < 0) throw std::runtime_error("Failed to open file");
+
+    struct stat info;
+    if (::fstat(descriptor, &info) != 0)
+    {
+        ::close(descriptor);
+        throw std::runtime_error("Failed to open file");
+    }
+
+    size_ = static_cast<size_t>(info.st_size);
+    if (size_ != 0)
+    {
+        void* address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (address == MAP_FAILED)
+        {
+            ::close(descriptor);
+            throw std::runtime_error("Failed to map file");
+        }
+        data_ = static_cast<const char*>(address);
+    }
+    ::close(descriptor); // Отображение остаётся действительным после закрытия дескриптора
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_ != nullptr) ::munmap(const_cast<char*>(data_), size_);
+}
+
+const char* MappedFile::data() const
+{
+    return data_;
+}
+
+size_t MappedFile::size() const
+{
+    return size_;
+}
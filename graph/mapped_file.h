@@ -0,0 +1,33 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string>
+#include <cstddef>
+
+// Файл, отображённый в память только для чтения.
+// Выбрасывает std::runtime_error, если файл не удалось открыть или отобразить
+class MappedFile
+{
+public:
+    // Конструктор с параметром
+    explicit MappedFile(const std::string& fileName);
+
+    // Отображение нельзя копировать: им владеет единственный объект
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Деструктор (снимает отображение)
+    ~MappedFile();
+
+    // Методы
+
+    // Получение начала отображения (nullptr для пустого файла)
+    const char* data() const;
+    // Получение размера файла
+    size_t size() const;
+
+private:
+    const char* data_ = nullptr; // Начало отображения
+    size_t size_ = 0; // Размер файла
+};
+#endif
@@ -0,0 +1,371 @@
+#ifndef PRIORITYQUEUES_H
+#define PRIORITYQUEUES_H
+
+#include <vector>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <utility>
+#include <functional>
+
+// Очереди с приоритетом для алгоритма Дейкстры.
+// Каждая очередь предоставляет одинаковый интерфейс:
+//   reset(capacity) — подготовка к работе с узлами [0, capacity)
+//   push(priority, node) — добавление узла или уменьшение его приоритета
+//   pop() — извлечение пары (приоритет, узел) с минимальным приоритетом
+//   empty() — проверка пустоты
+// Очереди без уменьшения ключа могут вернуть устаревшую пару, алгоритм обязан её пропустить
+
+// Двоичная куча с ленивым удалением (устаревшие пары остаются в куче)
+class BinaryHeapQueue
+{
+public:
+    void reset(size_t)
+    {
+        heap_.clear();
+    }
+
+    bool empty() const
+    {
+        return heap_.empty();
+    }
+
+    void push(double priority, size_t node)
+    {
+        heap_.emplace_back(priority, node);
+        std::push_heap(heap_.begin(), heap_.end(), std::greater<>());
+    }
+
+    std::pair<double, size_t> pop()
+    {
+        std::pop_heap(heap_.begin(), heap_.end(), std::greater<>());
+        auto top = heap_.back();
+        heap_.pop_back();
+        return top;
+    }
+
+    // Дополнительно к общему интерфейсу (нужно двунаправленному поиску):
+    // количество пар в куче (включая устаревшие) и пара с минимальным приоритетом без извлечения
+    size_t size() const
+    {
+        return heap_.size();
+    }
+
+    const std::pair<double, size_t>& top() const
+    {
+        return heap_.front();
+    }
+
+private:
+    std::vector<std::pair<double, size_t>> heap_; // Куча пар (приоритет, узел); память сохраняется между поисками
+};
+
+// Индексированная D-арная куча с уменьшением ключа (каждый узел хранится не более одного раза)
+template <size_t D>
+class DaryHeapQueue
+{
+    static_assert(D >= 2, "Heap arity must be at least 2");
+
+public:
+    void reset(size_t capacity)
+    {
+        heap_.clear();
+        positions_.assign(capacity, absent);
+        priorities_.resize(capacity);
+    }
+
+    bool empty() const
+    {
+        return heap_.empty();
+    }
+
+    void push(double priority, size_t node)
+    {
+        if (positions_[node] == absent)
+        {
+            // Новый узел добавляется в конец кучи
+            positions_[node] = heap_.size();
+            heap_.push_back(node);
+        }
+        else if (priority >= priorities_[node]) return; // Приоритет не уменьшился
+
+        priorities_[node] = priority;
+        siftUp(positions_[node]);
+    }
+
+    std::pair<double, size_t> pop()
+    {
+        size_t top = heap_.front();
+        positions_[top] = absent;
+
+        // Переносим последний элемент в корень и опускаем его
+        size_t last = heap_.back();
+        heap_.pop_back();
+        if (!heap_.empty())
+        {
+            heap_[0] = last;
+            positions_[last] = 0;
+            siftDown(0);
+        }
+        return {priorities_[top], top};
+    }
+
+private:
+    static constexpr size_t absent = std::numeric_limits<size_t>::max(); // Узла нет в куче
+
+    std::vector<size_t> heap_; // Узлы в порядке кучи
+    std::vector<size_t> positions_; // Позиция каждого узла в heap_
+    std::vector<double> priorities_; // Приоритеты узлов
+
+    void siftUp(size_t position)
+    {
+        size_t node = heap_[position];
+        while (position > 0)
+        {
+            size_t parent = (position - 1) / D;
+            if (priorities_[heap_[parent]] <= priorities_[node]) break;
+
+            heap_[position] = heap_[parent];
+            positions_[heap_[position]] = position;
+            position = parent;
+        }
+        heap_[position] = node;
+        positions_[node] = position;
+    }
+
+    void siftDown(size_t position)
+    {
+        size_t node = heap_[position];
+        while (true)
+        {
+            // Ищем потомка с минимальным приоритетом
+            size_t first = position * D + 1;
+            if (first >= heap_.size()) break;
+
+            size_t best = first;
+            size_t end = std::min(first + D, heap_.size());
+            for (size_t child = first + 1; child < end; ++child)
+            {
+                if (priorities_[heap_[child]] < priorities_[heap_[best]]) best = child;
+            }
+            if (priorities_[heap_[best]] >= priorities_[node]) break;
+
+            heap_[position] = heap_[best];
+            positions_[heap_[position]] = position;
+            position = best;
+        }
+        heap_[position] = node;
+        positions_[node] = position;
+    }
+};
+
+// Четверичная куча: неглубокое дерево с потомками в одной кэш-линии
+using QuaternaryHeapQueue = DaryHeapQueue<4>;
+
+// Поразрядная (radix) куча для монотонных неотрицательных приоритетов.
+// Неотрицательные double упорядочены так же, как их двоичные представления,
+// поэтому ключом служит битовый образ приоритета
+class RadixHeapQueue
+{
+public:
+    void reset(size_t)
+    {
+        for (auto& bucket : buckets_) bucket.clear();
+        size_ = 0;
+        last_ = 0;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    void push(double priority, size_t node)
+    {
+        uint64_t key = toKey(priority);
+        buckets_[bucketIndex(key)].emplace_back(key, node);
+        size_++;
+    }
+
+    std::pair<double, size_t> pop()
+    {
+        if (buckets_[0].empty())
+        {
+            // Находим первую непустую корзину и её минимальный ключ
+            size_t index = 1;
+            while (buckets_[index].empty()) index++;
+
+            uint64_t minimum = buckets_[index].front().first;
+            for (const auto& item : buckets_[index])
+            {
+                if (item.first < minimum) minimum = item.first;
+            }
+
+            // Перераспределяем корзину относительно нового минимума
+            last_ = minimum;
+            for (const auto& item : buckets_[index])
+            {
+                buckets_[bucketIndex(item.first)].push_back(item);
+            }
+            buckets_[index].clear();
+        }
+
+        auto item = buckets_[0].back();
+        buckets_[0].pop_back();
+        size_--;
+        return {toPriority(item.first), item.second};
+    }
+
+private:
+    std::array<std::vector<std::pair<uint64_t, size_t>>, 65> buckets_; // Корзина i хранит ключи, отличающиеся от last_ в старшем бите i - 1
+    size_t size_ = 0; // Количество элементов
+    uint64_t last_ = 0; // Последний извлечённый ключ
+
+    size_t bucketIndex(uint64_t key) const
+    {
+        return (key == last_) ? 0 : 64 - __builtin_clzll(key ^ last_);
+    }
+
+    static uint64_t toKey(double priority)
+    {
+        uint64_t key;
+        std::memcpy(&key, &priority, sizeof(key));
+        return key;
+    }
+
+    static double toPriority(uint64_t key)
+    {
+        double priority;
+        std::memcpy(&priority, &key, sizeof(priority));
+        return priority;
+    }
+};
+
+// Индексированная парная (pairing) куча с уменьшением ключа
+class PairingHeapQueue
+{
+public:
+    void reset(size_t capacity)
+    {
+        nodes_.assign(capacity, Node{});
+        root_ = none;
+        size_ = 0;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    void push(double priority, size_t node)
+    {
+        Node& item = nodes_[node];
+        if (item.inHeap)
+        {
+            if (priority >= item.priority) return; // Приоритет не уменьшился
+            item.priority = priority;
+            if (node == root_) return;
+
+            // Вырезаем поддерево узла и сливаем его с корнем
+            cut(node);
+            root_ = meld(root_, node);
+            return;
+        }
+
+        item = Node{};
+        item.priority = priority;
+        item.inHeap = true;
+        root_ = (root_ == none) ? node : meld(root_, node);
+        size_++;
+    }
+
+    std::pair<double, size_t> pop()
+    {
+        size_t top = root_;
+        nodes_[top].inHeap = false;
+        size_--;
+        root_ = mergePairs(nodes_[top].child);
+        if (root_ != none) nodes_[root_].previous = none;
+        return {nodes_[top].priority, top};
+    }
+
+private:
+    static constexpr size_t none = std::numeric_limits<size_t>::max(); // Отсутствующая ссылка
+
+    // Узел кучи: первый потомок, следующий брат и предыдущий брат (или родитель для первого потомка)
+    struct Node
+    {
+        double priority = 0.0;
+        size_t child = none;
+        size_t sibling = none;
+        size_t previous = none;
+        bool inHeap = false;
+    };
+
+    std::vector<Node> nodes_; // Узлы, индексируемые номером узла графа
+    size_t root_ = none; // Корень кучи
+    size_t size_ = 0; // Количество элементов
+
+    // Слияние двух корней: корень с большим приоритетом становится первым потомком другого
+    size_t meld(size_t first, size_t second)
+    {
+        if (nodes_[second].priority < nodes_[first].priority) std::swap(first, second);
+
+        nodes_[second].previous = first;
+        nodes_[second].sibling = nodes_[first].child;
+        if (nodes_[first].child != none) nodes_[nodes_[first].child].previous = second;
+        nodes_[first].child = second;
+        nodes_[first].sibling = none;
+        nodes_[first].previous = none;
+        return first;
+    }
+
+    // Отсоединение поддерева узла от его родителя
+    void cut(size_t node)
+    {
+        Node& item = nodes_[node];
+        if (nodes_[item.previous].child == node) nodes_[item.previous].child = item.sibling;
+        else nodes_[item.previous].sibling = item.sibling;
+        if (item.sibling != none) nodes_[item.sibling].previous = item.previous;
+        item.sibling = none;
+        item.previous = none;
+    }
+
+    // Двухпроходное слияние списка братьев
+    size_t mergePairs(size_t first)
+    {
+        if (first == none) return none;
+
+        // Первый проход: сливаем соседние пары слева направо, складывая результаты в стек
+        std::vector<size_t>& pairs = pairs_;
+        pairs.clear();
+        while (first != none)
+        {
+            size_t second = nodes_[first].sibling;
+            if (second == none)
+            {
+                nodes_[first].previous = none;
+                pairs.push_back(first);
+                break;
+            }
+            size_t next = nodes_[second].sibling;
+            nodes_[first].sibling = none;
+            nodes_[second].sibling = none;
+            pairs.push_back(meld(first, second));
+            first = next;
+        }
+
+        // Второй проход: сливаем результаты справа налево
+        size_t result = pairs.back();
+        for (size_t i = pairs.size() - 1; i > 0; --i)
+        {
+            result = meld(pairs[i - 1], result);
+        }
+        return result;
+    }
+
+    std::vector<size_t> pairs_; // Буфер для слияния пар (переиспользуется между извлечениями)
+};
+#endif
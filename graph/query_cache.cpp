@@ -0,0 +1,70 @@
+#include "query_cache.h"
+#include <stdexcept>
+
+QueryCache::QueryCache(size_t capacity):
+    capacity_(capacity)
+{
+    if (capacity_ == 0) throw std::invalid_argument("Cache capacity must be positive");
+}
+
+std::shared_ptr<const ShortestPaths> QueryCache::paths(const DirectedGraph& graph, QueryAlgorithm algorithm, size_t origin)
+{
+    Key key{algorithm, origin, graph.version()};
+
+    // Попадание: переносим результат в начало списка
+    auto found = index_.find(key);
+    if (found != index_.end())
+    {
+        stats_.hits++;
+        entries_.splice(entries_.begin(), entries_, found->second);
+        return found->second->second;
+    }
+
+    // Промах: вычисляем результат
+    stats_.misses++;
+    std::shared_ptr<const ShortestPaths> result;
+    switch (algorithm)
+    {
+        case QueryAlgorithm::Dijkstra:
+            result = std::make_shared<const ShortestPaths>(graph.dijkstraPaths(origin));
+            break;
+        case QueryAlgorithm::BellmanFord:
+            result = std::make_shared<const ShortestPaths>(graph.bellmanFordPaths(origin));
+            break;
+        case QueryAlgorithm::Wave:
+            result = std::make_shared<const ShortestPaths>(graph.wavePaths(origin));
+            break;
+    }
+
+    // Вытесняем давно не использованный результат
+    if (entries_.size() == capacity_)
+    {
+        index_.erase(entries_.back().first);
+        entries_.pop_back();
+        stats_.evictions++;
+    }
+    entries_.emplace_front(key, result);
+    index_[key] = entries_.begin();
+    return result;
+}
+
+QueryCache::Stats QueryCache::stats() const
+{
+    return stats_;
+}
+
+size_t QueryCache::size() const
+{
+    return entries_.size();
+}
+
+size_t QueryCache::capacity() const
+{
+    return capacity_;
+}
+
+void QueryCache::clear()
+{
+    entries_.clear();
+    index_.clear();
+}
@@ -0,0 +1,78 @@
+#ifndef QUERYCACHE_H
+#define QUERYCACHE_H
+
+#include "directed_graph.h"
+#include "batch_query.h"
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+// Ограниченный кэш результатов поиска путей из одного узла с вытеснением давно не использованных (LRU).
+// Ключ — алгоритм, исходный узел и версия графа, поэтому после изменения графа старые результаты
+// больше не находятся и постепенно вытесняются
+class QueryCache
+{
+public:
+    // Статистика обращений к кэшу
+    struct Stats
+    {
+        size_t hits = 0; // Результат найден в кэше
+        size_t misses = 0; // Результат вычислен заново
+        size_t evictions = 0; // Вытеснено результатов
+
+        // Доля попаданий
+        double hitRate() const
+        {
+            return (hits + misses == 0) ? 0.0 : double(hits) / (hits + misses);
+        }
+    };
+
+    // Конструктор с параметром: наибольшее число хранимых результатов
+    explicit QueryCache(size_t capacity = 256);
+
+    // Методы
+
+    // Получение результата из кэша или его вычисление (исключения алгоритма пробрасываются, результат не кэшируется)
+    std::shared_ptr<const ShortestPaths> paths(const DirectedGraph& graph, QueryAlgorithm algorithm, size_t origin);
+
+    // Получение статистики обращений
+    Stats stats() const;
+    // Получение количества хранимых результатов
+    size_t size() const;
+    // Получение наибольшего числа хранимых результатов
+    size_t capacity() const;
+    // Удаление всех результатов (статистика сохраняется)
+    void clear();
+
+private:
+    // Ключ результата
+    struct Key
+    {
+        QueryAlgorithm algorithm;
+        size_t origin;
+        size_t version;
+
+        bool operator==(const Key& other) const
+        {
+            return (algorithm == other.algorithm) && (origin == other.origin) && (version == other.version);
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const
+        {
+            size_t hash = key.version * 0x9E3779B97F4A7C15ull;
+            hash ^= key.origin + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2);
+            return hash ^ static_cast<size_t>(key.algorithm);
+        }
+    };
+
+    using Entry = std::pair<Key, std::shared_ptr<const ShortestPaths>>;
+
+    size_t capacity_; // Наибольшее число результатов
+    std::list<Entry> entries_; // Результаты от недавно использованных к давно не использованным
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_; // Поиск результата по ключу
+    Stats stats_; // Статистика обращений
+};
+#endif
@@ -0,0 +1,65 @@
+#ifndef SEARCHSTATE_H
+#define SEARCHSTATE_H
+
+#include "priority_queues.h"
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+// Состояние поиска для одной пары узлов с ленивой инициализацией расстояний:
+// расстояние узла действительно, только если его метка совпадает с текущей эпохой,
+// поэтому подготовка к новому поиску не зависит от размера графа
+struct SearchState
+{
+    std::vector<double> distances; // Расстояния до узлов
+    std::vector<double> estimates; // Оценки эвристики A* (действительны вместе с расстоянием)
+    std::vector<uint32_t> stamps; // Эпоха последней записи расстояния узла
+    uint32_t epoch = 0; // Текущая эпоха
+    BinaryHeapQueue queue; // Очередь обхода узлов
+    std::vector<size_t> nodes; // Очередь обхода в ширину (волновой алгоритм)
+
+    // Подготовка к новому поиску по узлам [0, capacity)
+    void reset(size_t capacity)
+    {
+        if (stamps.size() < capacity)
+        {
+            distances.resize(capacity);
+            estimates.resize(capacity);
+            stamps.resize(capacity, 0);
+        }
+        if (++epoch == 0)
+        {
+            // Счётчик эпох переполнился: сбрасываем метки один раз за 2^32 поисков
+            std::fill(stamps.begin(), stamps.end(), 0);
+            epoch = 1;
+        }
+        queue.reset(capacity);
+    }
+
+    bool visited(size_t key) const
+    {
+        return stamps[key] == epoch;
+    }
+
+    double distance(size_t key) const
+    {
+        return (stamps[key] == epoch) ? distances[key] : std::numeric_limits<double>::infinity();
+    }
+
+    void setDistance(size_t key, double distance)
+    {
+        distances[key] = distance;
+        stamps[key] = epoch;
+    }
+};
+
+// Состояния поиска переиспользуются между запросами одного потока (по одному на направление).
+// Запрос не должен вызывать другой запрос, пока использует состояние
+inline SearchState& searchState(size_t side)
+{
+    thread_local SearchState states[2];
+    return states[side];
+}
+#endif
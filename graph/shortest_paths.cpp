@@ -0,0 +1,83 @@
+#include "shortest_paths.h"
+#include <stdexcept>
+
+// Приватные методы
+
+void ShortestPaths::reset(size_t origin, size_t capacity)
+{
+    origin_ = origin;
+    distances_.assign(capacity, std::numeric_limits<double>::infinity());
+    predecessors_.assign(capacity, noPredecessor);
+    present_.assign(capacity, false);
+}
+
+// Публичные методы
+
+size_t ShortestPaths::origin() const
+{
+    return origin_;
+}
+
+size_t ShortestPaths::capacity() const
+{
+    return distances_.size();
+}
+
+bool ShortestPaths::contains(size_t key) const
+{
+    return (key < present_.size()) && present_[key];
+}
+
+bool ShortestPaths::isReachable(size_t key) const
+{
+    return contains(key) && (distances_[key] != std::numeric_limits<double>::infinity());
+}
+
+double ShortestPaths::distance(size_t key) const
+{
+    if (contains(key) == false) throw std::invalid_argument("This node is not in the graph");
+    return distances_[key];
+}
+
+size_t ShortestPaths::predecessor(size_t key) const
+{
+    if (contains(key) == false) throw std::invalid_argument("This node is not in the graph");
+    return predecessors_[key];
+}
+
+void ShortestPaths::reconstructPath(size_t destination, std::vector<size_t>& path) const
+{
+    if (contains(destination) == false) throw std::invalid_argument("Destination node is not in the graph");
+    if (isReachable(destination) == false) throw std::logic_error("No path exists between the nodes");
+
+    // Считаем длину пути, чтобы заполнить буфер с конца за один проход
+    size_t length = 1;
+    for (size_t node = destination; node != origin_; node = predecessors_[node])
+    {
+        length++;
+    }
+
+    path.resize(length);
+    for (size_t node = destination; length > 0; node = predecessors_[node])
+    {
+        path[--length] = node;
+    }
+}
+
+std::vector<size_t> ShortestPaths::reconstructPath(size_t destination) const
+{
+    std::vector<size_t> path;
+    reconstructPath(destination, path);
+    return path;
+}
+
+std::unordered_map<size_t, double> ShortestPaths::toMap() const
+{
+    std::unordered_map<size_t, double> result; // таблица узлов и расстояний
+
+    for (size_t key = 0; key < present_.size(); ++key)
+    {
+        if (present_[key] && (key != origin_)) result[key] = distances_[key];
+    }
+    return result;
+}
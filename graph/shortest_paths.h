@@ -0,0 +1,68 @@
+#ifndef SHORTESTPATHS_H
+#define SHORTESTPATHS_H
+
+#include <vector>
+#include <unordered_map>
+#include <limits>
+#include <cstddef>
+
+// Результат поиска кратчайших путей из одного узла.
+// Расстояния и предки хранятся в плотных массивах, индексируемых номером узла
+class ShortestPaths
+{
+public:
+    // Значение предка для исходного и недостижимых узлов
+    static constexpr size_t noPredecessor = std::numeric_limits<size_t>::max();
+
+    // Конструктор по умолчанию (пустой результат)
+    ShortestPaths():
+        origin_(0)
+    {}
+
+    // Конструктор с параметрами: все узлы недостижимы, ни одного существующего узла
+    ShortestPaths(size_t origin, size_t capacity):
+        origin_(origin),
+        distances_(capacity, std::numeric_limits<double>::infinity()),
+        predecessors_(capacity, noPredecessor),
+        present_(capacity, false)
+    {}
+
+    // Методы
+
+    // Получение исходного узла
+    size_t origin() const;
+    // Получение вместимости (максимальный номер узла + 1)
+    size_t capacity() const;
+
+    // Проверка, существовал ли узел в графе на момент поиска
+    bool contains(size_t key) const;
+    // Проверка достижимости узла из исходного
+    bool isReachable(size_t key) const;
+    // Расстояние до узла (бесконечность, если узел недостижим)
+    double distance(size_t key) const;
+    // Предыдущий узел на кратчайшем пути (noPredecessor, если его нет)
+    size_t predecessor(size_t key) const;
+
+    // Восстановление пути от исходного узла до заданного в переданный буфер (без выделения памяти при достаточной ёмкости)
+    void reconstructPath(size_t destination, std::vector<size_t>& path) const;
+    // Восстановление пути от исходного узла до заданного
+    std::vector<size_t> reconstructPath(size_t destination) const;
+
+    // Преобразование в таблицу узлов и расстояний (без исходного узла)
+    std::unordered_map<size_t, double> toMap() const;
+
+private:
+    // Результат заполняют только алгоритмы графа
+    friend class DirectedGraph;
+    friend class CompressedGraph;
+    friend class DynamicShortestPaths;
+
+    // Подготовка к новому поиску с сохранением выделенной памяти
+    void reset(size_t origin, size_t capacity);
+
+    size_t origin_; // Исходный узел
+    std::vector<double> distances_; // Расстояния до узлов
+    std::vector<size_t> predecessors_; // Предки узлов в дереве кратчайших путей
+    std::vector<bool> present_; // Битовая карта существующих узлов
+};
+#endif
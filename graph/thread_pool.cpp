@@ -0,0 +1,140 @@
+#include "thread_pool.h"
+#include <algorithm>
+#include <memory>
+
+ThreadPool::ThreadPool(size_t threads)
+{
+    if (threads == 0) threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+    workers_.reserve(threads - 1);
+    for (size_t thread = 1; thread < threads; ++thread)
+    {
+        workers_.emplace_back(&ThreadPool::workerLoop, this, thread);
+    }
+}
+
+ThreadPool& ThreadPool::local(size_t threads)
+{
+    if (threads == 0) threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+    thread_local std::unique_ptr<ThreadPool> pool;
+    if (pool == nullptr || pool->size() != threads)
+    {
+        pool.reset(); // Прежние потоки завершаются до запуска новых
+        pool = std::make_unique<ThreadPool>(threads);
+    }
+    return *pool;
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wakeUp_.notify_all();
+
+    for (auto& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+// Приватные методы
+
+void ThreadPool::workerLoop(size_t thread)
+{
+    size_t seen = 0; // Номер последней выполненной задачи
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wakeUp_.wait(lock, [&] { return stop_ || generation_ != seen; });
+            if (stop_) return;
+            seen = generation_;
+        }
+
+        runPart(thread);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--running_ == 0) done_.notify_one();
+        }
+    }
+}
+
+void ThreadPool::runPart(size_t thread)
+{
+    // Отрезок потока: равная доля от [0, count_)
+    size_t begin = 0;
+    size_t end = 0;
+    if (split_)
+    {
+        begin = count_ * thread / size();
+        end = count_ * (thread + 1) / size();
+        if (begin == end) return;
+    }
+
+    try
+    {
+        (*task_)(thread, begin, end);
+    }
+    catch(...)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_) error_ = std::current_exception();
+    }
+}
+
+void ThreadPool::dispatch(size_t count, bool split, const Task& task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        count_ = count;
+        split_ = split;
+        running_ = workers_.size();
+        error_ = nullptr;
+        generation_++;
+    }
+    wakeUp_.notify_all();
+
+    // Вызывающий поток выполняет свою часть сам
+    runPart(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [&] { return running_ == 0; });
+    task_ = nullptr;
+    if (error_) std::rethrow_exception(error_);
+}
+
+// Публичные методы
+
+size_t ThreadPool::size() const
+{
+    return workers_.size() + 1;
+}
+
+void ThreadPool::parallelFor(size_t count, const Task& task)
+{
+    if (count == 0) return;
+
+    // Без рабочих потоков выполняем задачу сразу
+    if (workers_.empty())
+    {
+        task(0, 0, count);
+        return;
+    }
+    dispatch(count, true, task);
+}
+
+void ThreadPool::runOnEach(const Task& task)
+{
+    if (workers_.empty())
+    {
+        task(0, 0, 0);
+        return;
+    }
+    dispatch(0, false, task);
+}
@@ -0,0 +1,66 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+// Пул потоков для параллельных алгоритмов графа.
+// Вызывающий поток участвует в работе как поток с номером 0
+class ThreadPool
+{
+public:
+    // Задача: номер потока, начало и конец отрезка работы
+    using Task = std::function<void(size_t thread, size_t begin, size_t end)>;
+
+    // Конструктор с параметром (0 — по числу аппаратных потоков)
+    explicit ThreadPool(size_t threads);
+
+    // Пул нельзя копировать и перемещать: потоки ссылаются на его состояние
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Деструктор (дожидается завершения потоков)
+    ~ThreadPool();
+
+    // Пул вызывающего потока с заданным числом потоков (0 — по числу аппаратных потоков).
+    // Создаётся при первом запросе и переиспользуется следующими запросами этого потока, поэтому
+    // повторные параллельные алгоритмы не запускают потоки заново; при другом числе потоков пересоздаётся.
+    // Задачи пула не должны запрашивать пул своего потока
+    static ThreadPool& local(size_t threads);
+
+    // Методы
+
+    // Получение количества потоков (включая вызывающий)
+    size_t size() const;
+    // Разбиение отрезка [0, count) на равные части и их параллельная обработка (возврат после завершения всех частей)
+    void parallelFor(size_t count, const Task& task);
+    // Запуск task(thread, 0, 0) на каждом потоке пула
+    void runOnEach(const Task& task);
+
+private:
+    std::vector<std::thread> workers_; // Рабочие потоки (номера 1..size()-1)
+    std::mutex mutex_; // Защита состояния пула
+    std::condition_variable wakeUp_; // Сигнал о новой задаче
+    std::condition_variable done_; // Сигнал о завершении задачи всеми потоками
+    const Task* task_ = nullptr; // Текущая задача
+    size_t count_ = 0; // Длина текущего отрезка работы
+    bool split_ = true; // Делить ли отрезок между потоками
+    size_t generation_ = 0; // Номер текущей задачи
+    size_t running_ = 0; // Количество рабочих потоков, ещё не завершивших задачу
+    bool stop_ = false; // Признак остановки пула
+    std::exception_ptr error_; // Первое исключение, выброшенное задачей
+
+    // Методы
+
+    // Цикл рабочего потока
+    void workerLoop(size_t thread);
+    // Выполнение части задачи потоком с номером thread
+    void runPart(size_t thread);
+    // Запуск задачи на всех потоках
+    void dispatch(size_t count, bool split, const Task& task);
+};
+#endif
@@ -0,0 +1,121 @@
+#include "../graph/landmarks.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include "testGraphs.h"
+#include <limits>
+
+// Тест: с нулевой эвристикой A* совпадает с алгоритмом Дейкстры
+TEST(AStarTest, ZeroHeuristic)
+{
+    DirectedGraph graph = makeRandomGraph(80, 300, 3);
+    auto zero = [](size_t) { return 0.0; };
+
+    for (size_t origin = 0; origin < 80; origin += 9)
+    {
+        ShortestPaths expected = graph.dijkstraPaths(origin);
+        for (size_t destination = 0; destination < 80; ++destination)
+        {
+            EXPECT_EQ(graph.aStar(origin, destination, zero), expected.distance(destination));
+        }
+    }
+}
+
+// Тест ошибок и недостижимого узла
+TEST(AStarTest, Errors)
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+    graph.insertNode(2);
+    graph.addVertex(0, 1.0, 1);
+    auto zero = [](size_t) { return 0.0; };
+
+    EXPECT_THROW(graph.aStar(0, 5, zero), std::invalid_argument);
+    EXPECT_THROW(graph.aStar(5, 0, zero), std::invalid_argument);
+    EXPECT_EQ(graph.aStar(0, 2, zero), std::numeric_limits<double>::infinity());
+    EXPECT_DOUBLE_EQ(graph.aStar(1, 1, zero), 0.0);
+
+    graph.addVertex(1, -1.0, 2);
+    EXPECT_THROW(graph.aStar(0, 1, zero), std::logic_error);
+    EXPECT_THROW(LandmarkIndex(graph, 2), std::logic_error);
+    EXPECT_THROW(LandmarkIndex(graph, 0), std::invalid_argument);
+}
+
+// Тест поиска по входящим рёбрам
+TEST(AStarTest, ReverseDijkstra)
+{
+    DirectedGraph graph = makeRandomGraph(50, 200, 5);
+    ShortestPaths toNode = graph.reverseDijkstraPaths(7);
+
+    for (size_t origin = 0; origin < 50; ++origin)
+    {
+        ShortestPaths fromNode = graph.dijkstraPaths(origin);
+        if (fromNode.isReachable(7)) EXPECT_NEAR(toNode.distance(origin), fromNode.distance(7), 1e-9); // Суммы весов в другом порядке
+        else EXPECT_FALSE(toNode.isReachable(origin));
+    }
+    size_t next = toNode.predecessor(0);
+    if (toNode.isReachable(0) && next != ShortestPaths::noPredecessor)
+    {
+        EXPECT_TRUE(graph.hasVertex(0, next));
+    }
+}
+
+// Тест: оценки ориентиров допустимы, а A* с ними находит кратчайшие пути
+TEST(AStarTest, LandmarksMatchDijkstra)
+{
+    for (unsigned seed = 1; seed <= 3; ++seed)
+    {
+        DirectedGraph graph = makeRandomGraph(120, 360, seed);
+        LandmarkIndex index(graph, 4);
+        EXPECT_EQ(index.landmarks().size(), 4);
+
+        for (size_t origin = 0; origin < 120; origin += 11)
+        {
+            ShortestPaths expected = graph.dijkstraPaths(origin);
+            for (size_t destination = 0; destination < 120; ++destination)
+            {
+                EXPECT_LE(index.lowerBound(origin, destination), expected.distance(destination) + 1e-9); // Оценка точна, если ориентир лежит на пути
+                double distance = index.shortestPath(graph, origin, destination);
+                if (expected.isReachable(destination)) EXPECT_NEAR(distance, expected.distance(destination), 1e-9);
+                else EXPECT_EQ(distance, std::numeric_limits<double>::infinity());
+            }
+        }
+    }
+}
+
+// Тест: на решётке ориентиры сокращают число извлечённых узлов
+TEST(AStarTest, LandmarksReduceSettledNodes)
+{
+    DirectedGraph graph = makeGridGraph(60, 9);
+    LandmarkIndex index(graph, 8);
+    auto zero = [](size_t) { return 0.0; };
+
+    size_t blindSettled = 0;
+    size_t landmarkSettled = 0;
+    for (size_t query = 0; query < 20; ++query)
+    {
+        size_t origin = query * 61;
+        size_t destination = origin + 15 * 61;
+        size_t settled = 0;
+
+        double expected = graph.aStar(origin, destination, zero, &settled);
+        blindSettled += settled;
+        EXPECT_NEAR(index.shortestPath(graph, origin, destination, &settled), expected, 1e-9);
+        landmarkSettled += settled;
+    }
+    EXPECT_LT(landmarkSettled * 3, blindSettled);
+}
+
+// Тест: индекс устаревает при изменении графа
+TEST(AStarTest, OutdatedIndex)
+{
+    DirectedGraph graph = makeRandomGraph(30, 90, 2);
+    LandmarkIndex index(graph, 3);
+    EXPECT_TRUE(index.isCurrent(graph));
+    EXPECT_EQ(index.landmarks().size(), 3);
+
+    graph.insertNode(30);
+    EXPECT_FALSE(index.isCurrent(graph));
+    EXPECT_THROW(index.shortestPath(graph, 0, 1), std::logic_error);
+    EXPECT_THROW(index.lowerBound(30, 1), std::invalid_argument);
+    EXPECT_DOUBLE_EQ(index.heuristic(1)(30), 0.0);
+}
@@ -0,0 +1,132 @@
+#include "../graph/all_pairs.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include "testGraphs.h"
+#include <limits>
+#include <cstdio>
+
+// Вспомогательная функция: параметры случайного графа с пропущенными номерами и, если negative,
+// отрицательными рёбрами без циклов отрицательного веса
+static RandomGraphOptions allPairsOptions(bool negative)
+{
+    RandomGraphOptions options;
+    options.gapPeriod = 7;
+    if (negative) options.maxPotential = 8.0;
+    return options;
+}
+
+// Вспомогательная функция: сравнение матрицы с алгоритмом Беллмана — Форда из каждого узла
+static void expectMatchesBellmanFord(const DistanceMatrix& matrix, const DirectedGraph& graph)
+{
+    ASSERT_EQ(matrix.size(), graph.size());
+    for (size_t origin : matrix.nodes())
+    {
+        ShortestPaths expected = graph.bellmanFordPaths(origin);
+        for (size_t destination : matrix.nodes())
+        {
+            double distance = matrix.distance(origin, destination);
+            if (expected.isReachable(destination)) EXPECT_NEAR(distance, expected.distance(destination), 1e-9);
+            else EXPECT_EQ(distance, std::numeric_limits<double>::infinity());
+        }
+    }
+}
+
+// Тест на небольшом графе
+TEST(AllPairsTest, SmallGraph)
+{
+    DirectedGraph graph(5);
+    for (size_t i : {0, 1, 2, 4})
+        graph.insertNode(i);
+    graph.addVertex(0, 4.0, 1);
+    graph.addVertex(0, 1.0, 2);
+    graph.addVertex(2, -2.0, 1);
+    graph.addVertex(1, 3.0, 4);
+
+    for (const DistanceMatrix& matrix : {floydWarshall(graph, 1), johnson(graph, 1)})
+    {
+        EXPECT_EQ(matrix.nodes(), std::vector<size_t>({0, 1, 2, 4}));
+        EXPECT_DOUBLE_EQ(matrix.distance(0, 1), -1.0);
+        EXPECT_DOUBLE_EQ(matrix.distance(0, 4), 2.0);
+        EXPECT_DOUBLE_EQ(matrix.distance(2, 4), 1.0);
+        EXPECT_DOUBLE_EQ(matrix.distance(4, 4), 0.0);
+        EXPECT_EQ(matrix.distance(4, 0), std::numeric_limits<double>::infinity());
+        EXPECT_DOUBLE_EQ(matrix.row(0)[1], -1.0);
+        EXPECT_FALSE(matrix.contains(3));
+        EXPECT_THROW(matrix.distance(3, 0), std::invalid_argument);
+    }
+}
+
+// Тест совпадения с алгоритмом Беллмана — Форда на случайных графах (больше одного блока)
+TEST(AllPairsTest, MatchesBellmanFord)
+{
+    for (unsigned seed = 1; seed <= 3; ++seed)
+    {
+        DirectedGraph sparse = makeRandomGraph(150, 600, seed, allPairsOptions(true));
+        expectMatchesBellmanFord(floydWarshall(sparse, 4), sparse);
+        expectMatchesBellmanFord(johnson(sparse, 4), sparse);
+
+        DirectedGraph dense = makeRandomGraph(140, 6000, seed + 10, allPairsOptions(seed % 2 == 0));
+        expectMatchesBellmanFord(floydWarshall(dense, 3), dense);
+        expectMatchesBellmanFord(allPairsShortestPaths(dense), dense);
+    }
+}
+
+// Тест цикла отрицательного веса
+TEST(AllPairsTest, NegativeCycle)
+{
+    DirectedGraph graph;
+    for (size_t i = 0; i < 3; ++i)
+        graph.insertNode(i);
+    graph.addVertex(0, 1.0, 1);
+    graph.addVertex(1, -3.0, 2);
+    graph.addVertex(2, 1.0, 0);
+
+    EXPECT_THROW(floydWarshall(graph), std::logic_error);
+    EXPECT_THROW(johnson(graph), std::logic_error);
+}
+
+// Тест пустого графа
+TEST(AllPairsTest, EmptyGraph)
+{
+    DirectedGraph graph;
+    EXPECT_EQ(floydWarshall(graph).size(), 0);
+    EXPECT_EQ(johnson(graph).size(), 0);
+}
+
+// Тест выгрузки матрицы в файл и повторного открытия
+TEST(AllPairsTest, SpillAndOpen)
+{
+    DirectedGraph graph = makeRandomGraph(90, 500, 21, allPairsOptions(true));
+    DistanceMatrix expected = johnson(graph, 2);
+
+    std::string spillFile = "all_pairs_spill.bin";
+    std::string savedFile = "all_pairs_saved.bin";
+    {
+        DistanceMatrix spilled = floydWarshall(graph, 2, spillFile);
+        expectMatchesBellmanFord(spilled, graph);
+    }
+    expected.save(savedFile);
+
+    for (const std::string& fileName : {spillFile, savedFile})
+    {
+        DistanceMatrix opened = DistanceMatrix::open(fileName);
+        ASSERT_EQ(opened.nodes(), expected.nodes());
+        for (size_t origin : opened.nodes())
+        {
+            for (size_t destination : opened.nodes())
+            {
+                double distance = expected.distance(origin, destination);
+                if (distance == std::numeric_limits<double>::infinity()) EXPECT_EQ(opened.distance(origin, destination), distance);
+                else EXPECT_NEAR(opened.distance(origin, destination), distance, 1e-9);
+            }
+        }
+    }
+    std::remove(savedFile.c_str());
+
+    // Незавершённая выгрузка (цикл отрицательного веса) не открывается
+    graph.addVertexes({{0, -1000.0, 1}, {1, -1000.0, 2}, {2, -1000.0, 0}});
+    EXPECT_THROW(floydWarshall(graph, 1, spillFile), std::logic_error);
+    EXPECT_THROW(DistanceMatrix::open(spillFile), std::runtime_error);
+    std::remove(spillFile.c_str());
+
+    EXPECT_THROW(DistanceMatrix::open("no_such_matrix.bin"), std::runtime_error);
+}
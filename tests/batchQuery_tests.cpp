@@ -0,0 +1,121 @@
+#include "../graph/batch_query.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include "testGraphs.h"
+#include <atomic>
+#include <new>
+#include <cstdlib>
+
+// Счётчик выделений памяти для проверки повторного использования буферов
+static std::atomic<size_t> allocations(0);
+
+void* operator new(size_t size)
+{
+    allocations++;
+    if (void* pointer = std::malloc(size ? size : 1)) return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+// Вспомогательная функция: смешанный пакет запросов
+static std::vector<Query> makeQueries(size_t nodes)
+{
+    std::vector<Query> queries;
+    for (size_t origin = 0; origin < nodes; origin += 5)
+    {
+        queries.push_back(Query{QueryAlgorithm::Dijkstra, origin});
+        queries.push_back(Query{QueryAlgorithm::Dijkstra, origin, (origin * 7 + 3) % nodes});
+        queries.push_back(Query{QueryAlgorithm::BellmanFord, origin});
+        queries.push_back(Query{QueryAlgorithm::Wave, origin});
+    }
+    return queries;
+}
+
+// Тест совпадения результатов с одиночными вызовами
+TEST(BatchQueryTest, MatchesSingleQueries)
+{
+    DirectedGraph graph = makeRandomGraph(100, 600, 1);
+    std::vector<Query> queries = makeQueries(100);
+
+    BatchQueryEngine engine(graph, 3);
+    std::vector<QueryResult> results = engine.run(queries);
+    ASSERT_EQ(results.size(), queries.size());
+
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+        const Query& query = queries[i];
+        ASSERT_TRUE(results[i].ok());
+
+        ShortestPaths expected;
+        if (query.algorithm == QueryAlgorithm::Dijkstra) expected = graph.dijkstraPaths(query.origin);
+        else if (query.algorithm == QueryAlgorithm::BellmanFord) expected = graph.bellmanFordPaths(query.origin);
+        else expected = graph.wavePaths(query.origin);
+
+        if (query.destination != DirectedGraph::unreachable)
+        {
+            EXPECT_EQ(results[i].distance, expected.distance(query.destination));
+            if (expected.isReachable(query.destination))
+            {
+                EXPECT_EQ(results[i].paths.reconstructPath(query.destination), expected.reconstructPath(query.destination));
+            }
+            continue;
+        }
+        for (size_t key = 0; key < 100; ++key)
+        {
+            EXPECT_EQ(results[i].paths.distance(key), expected.distance(key));
+        }
+    }
+}
+
+// Тест ошибок отдельных запросов
+TEST(BatchQueryTest, ErrorsArePerQuery)
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+    graph.insertNode(2);
+    graph.addVertex(0, -1.0, 1);
+
+    BatchQueryEngine engine(graph, 2);
+    std::vector<QueryResult> results = engine.run({
+        Query{QueryAlgorithm::Dijkstra, 0},
+        Query{QueryAlgorithm::BellmanFord, 0, 1},
+        Query{QueryAlgorithm::Wave, 0, 2},
+        Query{QueryAlgorithm::Wave, 9},
+    });
+
+    EXPECT_THROW(std::rethrow_exception(results[0].error), std::logic_error);
+    EXPECT_TRUE(results[1].ok());
+    EXPECT_DOUBLE_EQ(results[1].distance, -1.0);
+    EXPECT_THROW(std::rethrow_exception(results[2].error), std::logic_error);
+    EXPECT_THROW(std::rethrow_exception(results[3].error), std::invalid_argument);
+}
+
+// Тест отсутствия выделений памяти при повторном пакете
+TEST(BatchQueryTest, SteadyStateDoesNotAllocate)
+{
+    DirectedGraph graph = makeRandomGraph(200, 1200, 2);
+    std::vector<Query> queries = makeQueries(200);
+
+    // Один поток: распределение запросов по потокам не влияет на размер буферов
+    BatchQueryEngine engine(graph, 1);
+    std::vector<QueryResult> results;
+    engine.run(queries, results);
+
+    size_t before = allocations.load();
+    engine.run(queries, results);
+    EXPECT_EQ(allocations.load(), before);
+
+    for (const auto& result : results)
+    {
+        EXPECT_TRUE(result.ok());
+    }
+}
@@ -1,7 +1,9 @@
 #include "../graph/directed_graph.h"
 #include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include "../graph/thread_pool.h"
 #include <sstream>
 #include <limits>
+#include <random>
 
 // Тест базовых кратчайших путей с отрицательными весами
 TEST(BellmanFordTest, BasicShortestPathsWithNegativeWeights) 
@@ -141,4 +143,107 @@ TEST(BellmanFordTest, NegativeEdgeImprovement)
     graph.addVertex(2, -8.0, 0); // Цикл с отрицательным весом
     
     EXPECT_THROW(graph.bellmanFord(0), std::logic_error);
-}
\ No newline at end of file
+}
+
+// Тест результата в плотных массивах
+TEST(BellmanFordTest, DenseResult) 
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+    graph.insertNode(2);
+    
+    graph.addVertex(0, 4.0, 1);
+    graph.addVertex(0, 1.0, 2);
+    graph.addVertex(2, -2.0, 1);
+
+    ShortestPaths result = graph.bellmanFordPaths(0);
+
+    EXPECT_DOUBLE_EQ(result.distance(1), -1.0);
+    EXPECT_EQ(result.predecessor(1), 2);
+    EXPECT_EQ(result.predecessor(2), 0);
+    EXPECT_TRUE(result.isReachable(1));
+    EXPECT_EQ(result.toMap(), graph.bellmanFord(0));
+}
+
+
+// Вспомогательная функция: случайный граф с отрицательными весами без циклов (рёбра только от меньшего узла к большему)
+static DirectedGraph makeRandomDag(size_t nodes, size_t vertexes, unsigned seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<size_t> node(0, nodes - 1);
+    std::uniform_real_distribution<double> weight(-5.0, 10.0);
+
+    DirectedGraph graph(nodes);
+    for (size_t i = 0; i < nodes; ++i)
+    {
+        graph.insertNode(i);
+    }
+    for (size_t i = 0; i < vertexes; ++i)
+    {
+        size_t origin = node(generator);
+        size_t destination = node(generator);
+        if (origin >= destination) continue;
+        graph.addVertex(origin, weight(generator), destination);
+    }
+    return graph;
+}
+
+// Тест совпадения SPFA и параллельного варианта с классическим алгоритмом
+TEST(BellmanFordTest, VariantsMatchClassic) 
+{
+    ThreadPool pool(2); // Один пул на все запросы
+    for (unsigned seed = 1; seed <= 3; ++seed)
+    {
+        DirectedGraph graph = makeRandomDag(150, 900, seed);
+        ShortestPaths expected = graph.bellmanFordPaths(0);
+        ShortestPaths queued = graph.spfa(0);
+        ShortestPaths parallel = graph.parallelBellmanFord(0, 3);
+        ShortestPaths pooled = graph.parallelBellmanFord(0, pool);
+
+        for (size_t key = 0; key < 150; ++key)
+        {
+            EXPECT_DOUBLE_EQ(queued.distance(key), expected.distance(key));
+            EXPECT_DOUBLE_EQ(parallel.distance(key), expected.distance(key));
+            EXPECT_DOUBLE_EQ(pooled.distance(key), expected.distance(key));
+        }
+    }
+}
+
+// Тест обнаружения отрицательного цикла всеми вариантами
+TEST(BellmanFordTest, VariantsDetectNegativeCycle) 
+{
+    DirectedGraph graph;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        graph.insertNode(i);
+    }
+    graph.addVertex(0, 1.0, 1);
+    graph.addVertex(1, 1.0, 2);
+    graph.addVertex(2, -3.0, 3);
+    graph.addVertex(3, 1.0, 1);
+
+    EXPECT_THROW(graph.spfa(0), std::logic_error);
+    EXPECT_THROW(graph.parallelBellmanFord(0, 2), std::logic_error);
+    ThreadPool pool(2);
+    EXPECT_THROW(graph.parallelBellmanFord(0, pool), std::logic_error);
+    EXPECT_THROW(graph.parallelBellmanFord(0, pool), std::logic_error); // Пул пригоден после ошибки
+    EXPECT_THROW(graph.bellmanFordPaths(0), std::logic_error);
+}
+
+// Тест путей и ошибок вариантов
+TEST(BellmanFordTest, VariantsPathsAndErrors) 
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+    graph.insertNode(2);
+    graph.addVertex(0, 4.0, 1);
+    graph.addVertex(0, 1.0, 2);
+    graph.addVertex(2, -2.0, 1);
+
+    EXPECT_EQ(graph.spfa(0).reconstructPath(1), (std::vector<size_t>{0, 2, 1}));
+    EXPECT_EQ(graph.parallelBellmanFord(0).reconstructPath(1), (std::vector<size_t>{0, 2, 1}));
+    EXPECT_THROW(graph.spfa(7), std::invalid_argument);
+    EXPECT_THROW(graph.parallelBellmanFord(7), std::invalid_argument);
+}
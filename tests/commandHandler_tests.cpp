@@ -0,0 +1,91 @@
+#include "../user_interface/command_handler.cpp"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include <sstream>
+#include <cstdio>
+
+// Вспомогательная функция: небольшой граф с дробными и отрицательными весами
+static DirectedGraph makeCommandGraph()
+{
+    DirectedGraph graph;
+    for (size_t i = 0; i < 5; ++i)
+    {
+        graph.insertNode(i);
+    }
+    graph.addVertex(0, 1.5, 1);
+    graph.addVertex(1, -0.25, 2);
+    graph.addVertex(2, 3.0, 3);
+    graph.addVertex(0, 0.1, 3);
+    return graph;
+}
+
+// Вспомогательная функция: выполнение команд и вывод обработчика
+static std::string runCommands(const std::string& commands, DirectedGraph& graph)
+{
+    std::istringstream in(commands);
+    std::ostringstream out;
+    commandHandler(in, out, graph);
+    return out.str();
+}
+
+// Тест: команда Save записывает граф в каждом формате
+TEST(CommandHandlerTest, SaveInEveryFormat)
+{
+    DirectedGraph graph = makeCommandGraph();
+    std::string output = runCommands("Save command_graph.txt text\nSave command_graph.bin binary\n"
+                                     "Save command_graph.edges edges\nSave command_graph.dot dot\n", graph);
+    EXPECT_EQ(output.find("Invalid"), std::string::npos);
+
+    // Текстовый файл читается обратно тем же графом
+    DirectedGraph text;
+    ASSERT_TRUE(readData("command_graph.txt", text));
+    EXPECT_EQ(text.size(), 4); // Узел 4 без рёбер в текстовом формате не сохраняется
+    EXPECT_DOUBLE_EQ(text.removeVertex(1, 2), -0.25);
+    EXPECT_DOUBLE_EQ(text.removeVertex(0, 3), 0.1);
+
+    // Двоичный снимок сохраняет и узлы без рёбер
+    CompressedGraph snapshot = CompressedGraph::load("command_graph.bin", true);
+    EXPECT_EQ(snapshot.size(), 5);
+    EXPECT_EQ(snapshot.vertexCount(), 4);
+    EXPECT_TRUE(snapshot.hasVertex(2, 3));
+
+    std::ifstream edges("command_graph.edges");
+    std::string line;
+    ASSERT_TRUE(std::getline(edges, line));
+    EXPECT_EQ(line, "0 1 1.5");
+    std::ifstream dot("command_graph.dot");
+    ASSERT_TRUE(std::getline(dot, line));
+    EXPECT_EQ(line.rfind("digraph", 0), 0);
+
+    for (const char* fileName : {"command_graph.txt", "command_graph.bin", "command_graph.edges", "command_graph.dot"})
+    {
+        std::remove(fileName);
+    }
+}
+
+// Тест: команда Load добавляет рёбра из файла к графу
+TEST(CommandHandlerTest, LoadAddsVertexes)
+{
+    std::ofstream("command_load.txt") << "(3, 2.0, 4)\n(4, 1.0, 5)\nbroken\n";
+
+    DirectedGraph graph = makeCommandGraph();
+    std::string output = runCommands("Load command_load.txt\nBellman-Ford-path 0 5\n", graph);
+    EXPECT_NE(output.find("Data read successfully!"), std::string::npos);
+    EXPECT_NE(output.find("path: 0 -> 3 -> 4 -> 5 distance: 3.1"), std::string::npos);
+    EXPECT_TRUE(graph.hasVertex(4, 5));
+    std::remove("command_load.txt");
+}
+
+// Тест ошибок в аргументах команд
+TEST(CommandHandlerTest, SaveAndLoadErrors)
+{
+    DirectedGraph graph = makeCommandGraph();
+    std::string output = runCommands("Save command_graph.png png\n", graph);
+    EXPECT_NE(output.find("Invalid argument!"), std::string::npos);
+
+    output = runCommands("Save no_such_directory/graph.txt text\n", graph);
+    EXPECT_NE(output.find("Failed to save the graph!"), std::string::npos);
+
+    output = runCommands("Load no_such_file.txt\n", graph);
+    EXPECT_NE(output.find("Failed to open the file!"), std::string::npos);
+    EXPECT_EQ(graph.size(), 5);
+}
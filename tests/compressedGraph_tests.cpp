@@ -0,0 +1,281 @@
+#include "../graph/directed_graph.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include <limits>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+
+// Вспомогательная функция: граф из теста сложной топологии Дейкстры
+static DirectedGraph makeComplexGraph()
+{
+    DirectedGraph graph;
+    for (size_t i = 0; i < 6; ++i)
+    {
+        graph.insertNode(i);
+    }
+
+    graph.addVertex(0, 7.0, 1);
+    graph.addVertex(0, 9.0, 2);
+    graph.addVertex(0, 14.0, 5);
+    graph.addVertex(1, 10.0, 2);
+    graph.addVertex(1, 15.0, 3);
+    graph.addVertex(2, 2.0, 5);
+    graph.addVertex(2, 11.0, 3);
+    graph.addVertex(5, 9.0, 4);
+    graph.addVertex(3, 6.0, 4);
+    return graph;
+}
+
+// Тест пустого снимка
+TEST(CompressedGraphTest, EmptySnapshot)
+{
+    DirectedGraph graph;
+    CompressedGraph frozen = graph.freeze();
+
+    EXPECT_TRUE(frozen.isEmpty());
+    EXPECT_EQ(frozen.size(), 0);
+    EXPECT_EQ(frozen.vertexCount(), 0);
+    EXPECT_FALSE(frozen.searchNode(0));
+}
+
+// Тест структуры снимка
+TEST(CompressedGraphTest, StructureMatchesGraph)
+{
+    DirectedGraph graph(4);
+    graph.insertNode(0);
+    graph.insertNode(2);
+    graph.insertNode(3);
+    graph.addVertex(0, 1.5, 2);
+    graph.addVertex(2, 2.5, 3);
+
+    CompressedGraph frozen = graph.freeze();
+
+    EXPECT_EQ(frozen.size(), 3);
+    EXPECT_EQ(frozen.vertexCount(), 2);
+    EXPECT_TRUE(frozen.searchNode(0));
+    EXPECT_FALSE(frozen.searchNode(1));
+    EXPECT_FALSE(frozen.searchNode(10));
+    EXPECT_TRUE(frozen.hasVertex(0, 2));
+    EXPECT_TRUE(frozen.hasVertex(2, 3));
+    EXPECT_FALSE(frozen.hasVertex(3, 0));
+    EXPECT_THROW(frozen.hasVertex(1, 0), std::invalid_argument);
+}
+
+// Тест независимости снимка от последующих изменений графа
+TEST(CompressedGraphTest, SnapshotIsImmutable)
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+    graph.addVertex(0, 1.0, 1);
+
+    CompressedGraph frozen = graph.freeze();
+    graph.removeVertex(0, 1);
+    graph.insertNode(2);
+
+    EXPECT_TRUE(frozen.hasVertex(0, 1));
+    EXPECT_FALSE(frozen.searchNode(2));
+}
+
+// Тест совпадения результатов Дейкстры
+TEST(CompressedGraphTest, DijkstraMatchesGraph)
+{
+    DirectedGraph graph = makeComplexGraph();
+    CompressedGraph frozen = graph.freeze();
+
+    EXPECT_EQ(frozen.dijkstra(0), graph.dijkstra(0));
+    EXPECT_EQ(frozen.dijkstra(2), graph.dijkstra(2));
+    EXPECT_DOUBLE_EQ(frozen.dijkstra(0).at(4), 20.0);
+
+    ShortestPaths paths = frozen.dijkstraPaths(0);
+    EXPECT_DOUBLE_EQ(paths.distance(4), 20.0);
+    EXPECT_EQ(paths.predecessor(4), 5);
+}
+
+// Тест ошибок Дейкстры
+TEST(CompressedGraphTest, DijkstraErrors)
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+    graph.addVertex(0, -2.0, 1);
+    CompressedGraph frozen = graph.freeze();
+
+    EXPECT_THROW(frozen.dijkstra(0), std::logic_error);
+    EXPECT_THROW(frozen.dijkstra(7), std::invalid_argument);
+}
+
+// Тест совпадения результатов Беллмана — Форда
+TEST(CompressedGraphTest, BellmanFordMatchesGraph)
+{
+    DirectedGraph graph;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        graph.insertNode(i);
+    }
+    graph.addVertex(0, -5.0, 1);
+    graph.addVertex(0, 2.0, 2);
+    graph.addVertex(2, -1.0, 1);
+    graph.addVertex(1, 3.0, 3);
+
+    CompressedGraph frozen = graph.freeze();
+    auto result = frozen.bellmanFord(0);
+
+    EXPECT_EQ(result, graph.bellmanFord(0));
+    EXPECT_DOUBLE_EQ(result.at(3), -2.0);
+}
+
+// Тест обнаружения отрицательного цикла
+TEST(CompressedGraphTest, BellmanFordNegativeCycle)
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+    graph.insertNode(2);
+    graph.addVertex(0, 1.0, 1);
+    graph.addVertex(1, -3.0, 2);
+    graph.addVertex(2, 1.0, 0);
+
+    EXPECT_THROW(graph.freeze().bellmanFord(0), std::logic_error);
+}
+
+// Тест волнового алгоритма
+TEST(CompressedGraphTest, WaveMatchesGraph)
+{
+    DirectedGraph graph = makeComplexGraph();
+    CompressedGraph frozen = graph.freeze();
+
+    EXPECT_EQ(frozen.wave(0, 0), 0);
+    EXPECT_EQ(frozen.wave(0, 4), graph.wave(0, 4));
+    EXPECT_EQ(frozen.wave(0, 3), graph.wave(0, 3));
+    EXPECT_THROW(frozen.wave(4, 0), std::logic_error);
+    EXPECT_THROW(frozen.wave(0, 9), std::invalid_argument);
+}
+
+// Тест записи снимка в файл и открытия отображением в память
+TEST(CompressedGraphTest, SaveAndLoad)
+{
+    DirectedGraph graph = makeComplexGraph();
+    graph.removeNode(1);
+    graph.insertNode(70); // Узел за пределами первого слова битовой карты
+    graph.addVertex(4, 1.5, 70);
+
+    std::string fileName = "compressed_graph_test.bin";
+    graph.freeze().save(fileName);
+    CompressedGraph loaded = CompressedGraph::load(fileName, true);
+    CompressedGraph copy = loaded; // Копия разделяет отображение
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(loaded.size(), graph.size());
+    EXPECT_EQ(loaded.vertexCount(), graph.freeze().vertexCount());
+    EXPECT_FALSE(loaded.searchNode(1));
+    EXPECT_TRUE(loaded.searchNode(70));
+    EXPECT_TRUE(loaded.hasVertex(4, 70));
+    EXPECT_EQ(loaded.dijkstra(0), graph.dijkstra(0));
+    EXPECT_EQ(copy.wave(0, 70), graph.wave(0, 70));
+}
+
+// Тест сохранения пустого снимка
+TEST(CompressedGraphTest, SaveAndLoadEmpty)
+{
+    std::string fileName = "compressed_graph_empty.bin";
+    CompressedGraph().save(fileName);
+    CompressedGraph loaded = CompressedGraph::load(fileName, true);
+    std::remove(fileName.c_str());
+
+    EXPECT_TRUE(loaded.isEmpty());
+    EXPECT_EQ(loaded.vertexCount(), 0);
+    EXPECT_FALSE(loaded.searchNode(0));
+}
+
+// Тест обнаружения повреждённых файлов
+TEST(CompressedGraphTest, LoadRejectsCorruptedFiles)
+{
+    std::string fileName = "compressed_graph_corrupted.bin";
+    makeComplexGraph().freeze().save(fileName);
+
+    std::string content;
+    {
+        std::ifstream file(fileName, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    auto rewrite = [&](const std::string& data)
+    {
+        std::ofstream(fileName, std::ios::binary | std::ios::trunc) << data;
+    };
+
+    // Изменённый вес ребра находит только проверка контрольной суммы
+    std::string damaged = content;
+    damaged[damaged.size() - 3] ^= 0x10;
+    rewrite(damaged);
+    EXPECT_NO_THROW(CompressedGraph::load(fileName));
+    EXPECT_THROW(CompressedGraph::load(fileName, true), std::runtime_error);
+
+    // Обрезанный файл и чужая сигнатура
+    rewrite(content.substr(0, content.size() - 8));
+    EXPECT_THROW(CompressedGraph::load(fileName), std::runtime_error);
+    damaged = content;
+    damaged[0] = 'X';
+    rewrite(damaged);
+    EXPECT_THROW(CompressedGraph::load(fileName), std::runtime_error);
+
+    std::remove(fileName.c_str());
+    EXPECT_THROW(CompressedGraph::load(fileName), std::runtime_error);
+}
+
+// Тест: повреждённые смещения и узлы назначения при верном заголовке и размере файла
+TEST(CompressedGraphTest, CorruptedArrays)
+{
+    std::string fileName = "compressed_graph_arrays.bin";
+    makeComplexGraph().freeze().save(fileName);
+
+    std::string content;
+    {
+        std::ifstream file(fileName, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    // Расположение массивов: заголовок и массивы выровнены по 64 байта
+    auto alignUp = [](size_t value) { return (value + 63) / 64 * 64; };
+    uint64_t capacity = 0;
+    std::memcpy(&capacity, content.data() + 16, sizeof(capacity));
+    size_t offsets = alignUp(64 + (capacity + 63) / 64 * sizeof(uint64_t));
+    size_t destinations = alignUp(offsets + (capacity + 1) * sizeof(size_t));
+
+    // Запись значения в копию файла и сообщение ошибки загрузки (пустое, если загрузка прошла)
+    auto loadDamaged = [&](size_t position, size_t value, bool verify) -> std::string
+    {
+        std::string damaged = content;
+        std::memcpy(&damaged[position], &value, sizeof(value));
+        std::ofstream(fileName, std::ios::binary | std::ios::trunc) << damaged;
+        try
+        {
+            CompressedGraph::load(fileName, verify);
+        }
+        catch (const std::runtime_error& error)
+        {
+            return error.what();
+        }
+        return "";
+    };
+
+    // Структура массивов проверяется и без verify: граф из снимка не строится на повреждённых данных
+    EXPECT_EQ(loadDamaged(offsets, 1, false), "Snapshot file is corrupted");
+    EXPECT_EQ(loadDamaged(offsets + capacity * sizeof(size_t), 100, false), "Snapshot file is corrupted");
+    EXPECT_EQ(loadDamaged(offsets + sizeof(size_t), 1000, false), "Snapshot file is corrupted");
+    EXPECT_EQ(loadDamaged(destinations, capacity + 5, false), "Snapshot file is corrupted");
+    EXPECT_EQ(loadDamaged(destinations, std::numeric_limits<size_t>::max(), false), "Snapshot file is corrupted");
+    EXPECT_EQ(loadDamaged(destinations, capacity + 5, true), "Snapshot file is corrupted");
+
+    // Граф из повреждённого файла без verify не строится
+    std::string damaged = content;
+    size_t outside = capacity + 5;
+    std::memcpy(&damaged[destinations], &outside, sizeof(outside));
+    std::ofstream(fileName, std::ios::binary | std::ios::trunc) << damaged;
+    EXPECT_THROW(DirectedGraph restored(CompressedGraph::load(fileName)), std::runtime_error);
+
+    // Неповреждённый файл проходит все проверки
+    EXPECT_EQ(loadDamaged(offsets, 0, true), "");
+    std::remove(fileName.c_str());
+}
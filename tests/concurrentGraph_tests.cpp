@@ -0,0 +1,172 @@
+#include "../graph/concurrent_graph.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <vector>
+
+// Тест основных операций
+TEST(ConcurrentGraphTest, BasicOperations)
+{
+    ConcurrentGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+    graph.insertNode(2);
+    graph.addVertex(0, 1.0, 1);
+    graph.addVertex(1, 2.0, 2);
+    EXPECT_TRUE(graph.searchNode(1));
+    EXPECT_TRUE(graph.hasVertex(0, 1));
+    EXPECT_DOUBLE_EQ(graph.shortestPath(0, 2), 3.0);
+    EXPECT_DOUBLE_EQ(graph.dijkstra(0).at(2), 3.0);
+
+    EXPECT_DOUBLE_EQ(graph.removeVertex(1, 2), 2.0);
+    EXPECT_FALSE(graph.hasVertex(1, 2));
+    graph.removeNode(1);
+    EXPECT_FALSE(graph.searchNode(1));
+    EXPECT_EQ(graph.read([](const DirectedGraph& current) { return current.isEmpty(); }), false);
+}
+
+// Тест: снимок не меняется, ошибка в пакете изменений не публикует его части
+TEST(ConcurrentGraphTest, SnapshotsAndUpdates)
+{
+    DirectedGraph source;
+    source.insertNode(0);
+    source.insertNode(1);
+    ConcurrentGraph graph(source);
+    EXPECT_EQ(graph.version(), source.version());
+
+    DirectedGraph snapshot = graph.snapshot();
+    size_t version = graph.version();
+    graph.update([](DirectedGraph& current)
+    {
+        current.addVertex(0, 1.0, 1);
+        current.insertNode(2);
+    });
+    EXPECT_NE(graph.version(), version);
+    EXPECT_FALSE(snapshot.hasVertex(0, 1));
+    EXPECT_FALSE(snapshot.searchNode(2));
+    EXPECT_TRUE(graph.hasVertex(0, 1));
+
+    version = graph.version();
+    EXPECT_THROW(graph.update([](DirectedGraph& current)
+    {
+        current.insertNode(3);
+        current.removeVertex(1, 0); // Ребра нет
+    }), std::logic_error);
+    EXPECT_FALSE(graph.searchNode(3));
+    EXPECT_EQ(graph.version(), version);
+    EXPECT_FALSE(source.hasVertex(0, 1)); // Исходный граф не меняется
+}
+
+// Тест одновременного чтения и записи: читатели всегда видят согласованную версию
+TEST(ConcurrentGraphTest, ConcurrentReadersAndWriters)
+{
+    const size_t nodes = 200;
+    ConcurrentGraph graph(nodes);
+    for (size_t i = 0; i < nodes; ++i)
+    {
+        graph.insertNode(i);
+    }
+
+    // Писатели удлиняют цепочку по одному ребру: в каждой версии цепочка от узла 0 непрерывна
+    std::atomic<bool> done(false);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t)
+    {
+        readers.emplace_back([&]()
+        {
+            while (!done.load())
+            {
+                graph.read([&](const DirectedGraph& current)
+                {
+                    // Узлы цепочки достижимы на своих расстояниях, остальные недостижимы
+                    std::unordered_map<size_t, double> distances = current.dijkstra(0);
+                    size_t length = 0;
+                    while (length + 1 < nodes && current.hasVertex(length, length + 1)) ++length;
+                    for (const auto& [node, distance] : distances)
+                    {
+                        if (node <= length) EXPECT_DOUBLE_EQ(distance, double(node));
+                        else EXPECT_EQ(distance, std::numeric_limits<double>::infinity());
+                    }
+                });
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    std::atomic<size_t> next(0);
+    for (int t = 0; t < 2; ++t)
+    {
+        writers.emplace_back([&]()
+        {
+            for (;;)
+            {
+                bool added = graph.update([&](DirectedGraph& current)
+                {
+                    size_t node = next.load();
+                    if (node + 1 >= nodes) return false;
+                    current.addVertex(node, 1.0, node + 1);
+                    next.store(node + 1);
+                    return true;
+                });
+                if (!added) break;
+            }
+        });
+    }
+    for (std::thread& writer : writers)
+    {
+        writer.join();
+    }
+    done.store(true);
+    for (std::thread& reader : readers)
+    {
+        reader.join();
+    }
+
+    EXPECT_DOUBLE_EQ(graph.shortestPath(0, nodes - 1), double(nodes - 1));
+}
+
+// Тест: прежние версии освобождаются, когда их покидают читатели, без последующих записей
+TEST(ConcurrentGraphTest, RetiredVersionsFreedByReaders)
+{
+    ConcurrentGraph graph(10);
+    for (size_t i = 0; i < 10; ++i)
+    {
+        graph.insertNode(i);
+    }
+    EXPECT_EQ(graph.retiredVersions(), 0);
+
+    // Читатель удерживает версию, пока идут записи
+    std::atomic<bool> reading(false);
+    std::atomic<bool> release(false);
+    std::thread reader([&]()
+    {
+        graph.read([&](const DirectedGraph& current)
+        {
+            reading.store(true);
+            while (!release.load()) std::this_thread::yield();
+            EXPECT_FALSE(current.hasVertex(0, 1)); // Удерживаемая версия не меняется
+        });
+    });
+    while (!reading.load()) std::this_thread::yield();
+
+    for (size_t i = 0; i + 1 < 10; ++i)
+    {
+        graph.addVertex(i, 1.0, i + 1);
+    }
+    EXPECT_GT(graph.retiredVersions(), 0);
+    graph.collect();
+    EXPECT_GT(graph.retiredVersions(), 0); // Версию ещё читают
+
+    // Выход читателя освобождает все прежние версии
+    release.store(true);
+    reader.join();
+    EXPECT_EQ(graph.retiredVersions(), 0);
+
+    // Чтения после записей не оставляют прежних версий
+    graph.addVertex(0, 2.0, 1);
+    EXPECT_EQ(graph.retiredVersions(), 0);
+    EXPECT_DOUBLE_EQ(graph.shortestPath(0, 9), 10.0);
+    graph.collect();
+    EXPECT_EQ(graph.retiredVersions(), 0);
+}
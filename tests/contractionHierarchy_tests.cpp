@@ -0,0 +1,152 @@
+#include "../graph/contraction_hierarchy.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include "testGraphs.h"
+#include <limits>
+#include <cstdio>
+#include <fstream>
+
+// Вспомогательная функция: случайный граф с положительными весами и пропущенными номерами
+static DirectedGraph makeSparseKeyGraph(size_t nodes, size_t vertexes, unsigned seed)
+{
+    RandomGraphOptions options;
+    options.gapPeriod = 9;
+    return makeRandomGraph(nodes, vertexes, seed, options);
+}
+
+// Вспомогательная функция: сравнение запросов к индексу с алгоритмом Дейкстры
+static void expectMatchesDijkstra(const ContractionHierarchy& hierarchy, const DirectedGraph& graph, size_t step)
+{
+    ASSERT_EQ(hierarchy.size(), graph.size());
+    size_t counter = 0;
+    graph.forEachNode([&](size_t origin)
+    {
+        if (counter++ % step != 0) return;
+        ShortestPaths expected = graph.dijkstraPaths(origin);
+        graph.forEachNode([&](size_t destination)
+        {
+            double distance = hierarchy.shortestPath(origin, destination);
+            if (expected.isReachable(destination)) EXPECT_NEAR(distance, expected.distance(destination), 1e-9);
+            else EXPECT_EQ(distance, std::numeric_limits<double>::infinity());
+        });
+    });
+}
+
+// Тест на небольшом графе: сокращение добавляется только без пути-свидетеля
+TEST(ContractionHierarchyTest, SmallGraph)
+{
+    DirectedGraph graph;
+    for (size_t i = 0; i < 5; ++i)
+        graph.insertNode(i);
+    graph.addVertex(0, 1.0, 1);
+    graph.addVertex(1, 1.0, 2);
+    graph.addVertex(0, 5.0, 2);
+    graph.addVertex(2, 2.0, 3);
+    graph.addVertex(3, 3.0, 3); // Петля не влияет на расстояния
+
+    ContractionHierarchy hierarchy(graph);
+    EXPECT_EQ(hierarchy.size(), 5);
+    EXPECT_DOUBLE_EQ(hierarchy.shortestPath(0, 2), 2.0);
+    EXPECT_DOUBLE_EQ(hierarchy.shortestPath(0, 3), 4.0);
+    EXPECT_DOUBLE_EQ(hierarchy.shortestPath(3, 3), 0.0);
+    EXPECT_EQ(hierarchy.shortestPath(3, 0), std::numeric_limits<double>::infinity());
+    EXPECT_EQ(hierarchy.shortestPath(0, 4), std::numeric_limits<double>::infinity());
+}
+
+// Тест совпадения с алгоритмом Дейкстры на случайных графах и решётке
+TEST(ContractionHierarchyTest, MatchesDijkstra)
+{
+    for (unsigned seed = 1; seed <= 3; ++seed)
+    {
+        DirectedGraph sparse = makeSparseKeyGraph(200, 500, seed);
+        expectMatchesDijkstra(ContractionHierarchy(sparse), sparse, 7);
+
+        DirectedGraph dense = makeSparseKeyGraph(120, 2000, seed + 10);
+        expectMatchesDijkstra(ContractionHierarchy(dense), dense, 11);
+    }
+
+    DirectedGraph grid = makeGridGraph(30, 4);
+    ContractionHierarchy hierarchy(grid);
+    expectMatchesDijkstra(hierarchy, grid, 37);
+    EXPECT_GT(hierarchy.shortcutCount(), 0);
+}
+
+// Тест: запрос к индексу просматривает меньше узлов, чем поиск по исходному графу
+TEST(ContractionHierarchyTest, ReducesSettledNodes)
+{
+    DirectedGraph graph = makeGridGraph(60, 9);
+    ContractionHierarchy hierarchy(graph);
+    auto zero = [](size_t) { return 0.0; };
+
+    size_t blindSettled = 0;
+    size_t hierarchySettled = 0;
+    for (size_t query = 0; query < 20; ++query)
+    {
+        size_t origin = query * 61;
+        size_t destination = origin + 15 * 61;
+        size_t settled = 0;
+
+        double expected = graph.aStar(origin, destination, zero, &settled);
+        blindSettled += settled;
+        EXPECT_NEAR(hierarchy.shortestPath(origin, destination, &settled), expected, 1e-9);
+        hierarchySettled += settled;
+    }
+    EXPECT_LT(hierarchySettled * 3, blindSettled);
+}
+
+// Тест ошибок
+TEST(ContractionHierarchyTest, Errors)
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(2);
+    graph.addVertex(0, 1.0, 2);
+
+    ContractionHierarchy hierarchy(graph);
+    EXPECT_FALSE(hierarchy.contains(1));
+    EXPECT_THROW(hierarchy.shortestPath(0, 1), std::invalid_argument);
+    EXPECT_THROW(hierarchy.shortestPath(7, 0), std::invalid_argument);
+
+    graph.insertNode(3);
+    graph.addVertex(2, 0.0, 3); // Нулевой вес допустим
+    EXPECT_DOUBLE_EQ(ContractionHierarchy(graph).shortestPath(0, 3), 1.0);
+    graph.addVertex(3, -1.0, 0);
+    EXPECT_THROW(ContractionHierarchy{graph}, std::logic_error);
+
+    DirectedGraph empty;
+    EXPECT_EQ(ContractionHierarchy(empty).size(), 0);
+}
+
+// Тест записи индекса в файл и чтения
+TEST(ContractionHierarchyTest, SaveAndLoad)
+{
+    DirectedGraph graph = makeSparseKeyGraph(150, 600, 21);
+    ContractionHierarchy hierarchy(graph);
+    std::string fileName = "contraction_hierarchy.bin";
+    hierarchy.save(fileName);
+
+    ContractionHierarchy loaded = ContractionHierarchy::load(fileName);
+    EXPECT_EQ(loaded.size(), hierarchy.size());
+    EXPECT_EQ(loaded.shortcutCount(), hierarchy.shortcutCount());
+    expectMatchesDijkstra(loaded, graph, 5);
+
+    // Обрезанный файл
+    std::ifstream source(fileName, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(source)), std::istreambuf_iterator<char>());
+    source.close();
+    {
+        std::ofstream truncated(fileName, std::ios::binary | std::ios::trunc);
+        truncated.write(content.data(), content.size() - 8);
+    }
+    EXPECT_THROW(ContractionHierarchy::load(fileName), std::runtime_error);
+
+    // Неверная сигнатура
+    content[0] = 'X';
+    {
+        std::ofstream corrupted(fileName, std::ios::binary | std::ios::trunc);
+        corrupted.write(content.data(), content.size());
+    }
+    EXPECT_THROW(ContractionHierarchy::load(fileName), std::runtime_error);
+    std::remove(fileName.c_str());
+
+    EXPECT_THROW(ContractionHierarchy::load("no_such_index.bin"), std::runtime_error);
+}
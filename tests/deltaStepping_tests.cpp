@@ -0,0 +1,116 @@
+#include "../graph/directed_graph.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include "../graph/thread_pool.h"
+#include "testGraphs.h"
+#include <limits>
+
+// Тест базовых кратчайших путей
+TEST(DeltaSteppingTest, BasicShortestPaths)
+{
+    DirectedGraph graph;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        graph.insertNode(i);
+    }
+    graph.addVertex(0, 5.0, 1);
+    graph.addVertex(0, 2.0, 2);
+    graph.addVertex(2, 1.0, 1);
+    graph.addVertex(1, 3.0, 3);
+
+    ShortestPaths result = graph.deltaStepping(0, 2.0, 2);
+
+    EXPECT_DOUBLE_EQ(result.distance(1), 3.0);
+    EXPECT_DOUBLE_EQ(result.distance(3), 6.0);
+    EXPECT_EQ(result.reconstructPath(3), (std::vector<size_t>{0, 2, 1, 3}));
+}
+
+// Тест ошибок
+TEST(DeltaSteppingTest, Errors)
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+
+    EXPECT_THROW(graph.deltaStepping(5, 1.0), std::invalid_argument);
+    EXPECT_THROW(graph.deltaStepping(0, 0.0), std::invalid_argument);
+    EXPECT_THROW(graph.deltaStepping(0, std::numeric_limits<double>::infinity()), std::invalid_argument);
+    EXPECT_THROW(graph.deltaStepping(0, std::numeric_limits<double>::quiet_NaN()), std::invalid_argument);
+
+    graph.addVertex(0, -1.0, 1);
+    EXPECT_THROW(graph.deltaStepping(0, 1.0), std::logic_error);
+}
+
+// Тест изолированного исходного узла
+TEST(DeltaSteppingTest, IsolatedOrigin)
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+
+    ShortestPaths result = graph.deltaStepping(0, 1.0, 3);
+    EXPECT_FALSE(result.isReachable(1));
+    EXPECT_EQ(result.toMap(), graph.dijkstra(0));
+}
+
+// Тест совпадения с алгоритмом Дейкстры при разной ширине корзины и числе потоков
+TEST(DeltaSteppingTest, MatchesDijkstra)
+{
+    for (unsigned seed = 1; seed <= 3; ++seed)
+    {
+        DirectedGraph graph = makeRandomGraph(300, 1500, seed);
+        ShortestPaths expected = graph.dijkstraPaths(0);
+
+        for (double delta : {0.25, 1.0, 3.0, 50.0})
+        {
+            for (size_t threads : {1, 2, 4})
+            {
+                ShortestPaths actual = graph.deltaStepping(0, delta, threads);
+                for (size_t key = 0; key < 300; ++key)
+                {
+                    EXPECT_EQ(actual.distance(key), expected.distance(key));
+                }
+            }
+        }
+    }
+}
+
+// Тест: очень узкие корзины не приводят к огромному кольцу корзин
+TEST(DeltaSteppingTest, TinyDelta)
+{
+    DirectedGraph graph = makeRandomGraph(200, 1000, 7);
+    ShortestPaths expected = graph.dijkstraPaths(0);
+
+    for (double delta : {1e-9, 1e-300, std::numeric_limits<double>::denorm_min()})
+    {
+        ShortestPaths actual = graph.deltaStepping(0, delta, 2);
+        for (size_t key = 0; key < 200; ++key)
+        {
+            EXPECT_EQ(actual.distance(key), expected.distance(key));
+        }
+    }
+}
+
+// Тест: вызовы переиспользуют потоки переданного пула и пула вызывающего потока
+TEST(DeltaSteppingTest, ReusesThreadPool)
+{
+    DirectedGraph graph = makeRandomGraph(300, 1500, 11);
+    ShortestPaths expected = graph.dijkstraPaths(0);
+
+    ThreadPool pool(3);
+    for (double delta : {0.5, 4.0})
+    {
+        ShortestPaths actual = graph.deltaStepping(0, delta, pool);
+        for (size_t key = 0; key < 300; ++key)
+        {
+            EXPECT_EQ(actual.distance(key), expected.distance(key));
+        }
+    }
+    EXPECT_THROW(graph.deltaStepping(0, 0.0, pool), std::invalid_argument);
+    EXPECT_EQ(graph.deltaStepping(0, 1.0, pool).distance(299), expected.distance(299)); // Пул пригоден после ошибки
+
+    // Пул потока создаётся один раз на число потоков
+    ThreadPool& local = ThreadPool::local(3);
+    EXPECT_EQ(local.size(), 3);
+    graph.deltaStepping(0, 1.0, 3);
+    EXPECT_EQ(&ThreadPool::local(3), &local);
+}
@@ -128,4 +128,74 @@ TEST(DijkstraTest, ParallelEdges)
     
     auto result = graph.dijkstra(0);
     EXPECT_DOUBLE_EQ(result.at(1), 3.0);
-}
\ No newline at end of file
+}
+
+// Тест результата в плотных массивах
+TEST(DijkstraTest, DenseResult) 
+{
+    DirectedGraph graph(6);
+    graph.insertNode(0);
+    graph.insertNode(1);
+    graph.insertNode(2);
+    graph.insertNode(4); // Узел 3 отсутствует, узел 4 недостижим
+    
+    graph.addVertex(0, 5.0, 1);
+    graph.addVertex(0, 2.0, 2);
+    graph.addVertex(2, 1.0, 1);
+
+    ShortestPaths result = graph.dijkstraPaths(0);
+
+    EXPECT_EQ(result.origin(), 0);
+    EXPECT_EQ(result.capacity(), 6);
+    EXPECT_DOUBLE_EQ(result.distance(0), 0.0);
+    EXPECT_DOUBLE_EQ(result.distance(1), 3.0);
+    EXPECT_EQ(result.predecessor(1), 2);
+    EXPECT_EQ(result.predecessor(2), 0);
+    EXPECT_EQ(result.predecessor(0), ShortestPaths::noPredecessor);
+
+    EXPECT_FALSE(result.contains(3));
+    EXPECT_THROW(result.distance(3), std::invalid_argument);
+    EXPECT_TRUE(result.contains(4));
+    EXPECT_FALSE(result.isReachable(4));
+
+    EXPECT_EQ(result.toMap(), graph.dijkstra(0));
+}
+
+// Тест учёта рёбер с неположительным весом при изменениях графа
+TEST(DijkstraTest, NegativeWeightTracking) 
+{
+    DirectedGraph graph;
+    for (size_t i = 0; i < 4; ++i)
+        graph.insertNode(i);
+    graph.addVertex(0, 1.0, 1);
+    graph.addVertex(1, -1.0, 2);
+    EXPECT_THROW(graph.dijkstra(0), std::logic_error);
+
+    // Обновление веса на положительный снимает запрет
+    graph.addVertex(1, 2.0, 2);
+    EXPECT_DOUBLE_EQ(graph.dijkstra(0).at(2), 3.0);
+
+    // Удаление отрицательного ребра
+    graph.addVertex(2, 0.0, 3);
+    EXPECT_THROW(graph.shortestPath(0, 3), std::logic_error);
+    graph.removeVertex(2, 3);
+    EXPECT_NO_THROW(graph.shortestPath(0, 2));
+
+    // Удаление узла вместе с входящим и исходящим отрицательными рёбрами и петлёй
+    graph.addVertex(3, -1.0, 1);
+    graph.addVertex(2, -2.0, 3);
+    graph.addVertex(3, -3.0, 3);
+    DirectedGraph copy = graph;
+    EXPECT_THROW(copy.dijkstra(0), std::logic_error);
+    graph.removeNode(3);
+    EXPECT_DOUBLE_EQ(graph.dijkstra(0).at(2), 3.0);
+    EXPECT_THROW(copy.dijkstra(0), std::logic_error); // Копия не зависит от оригинала
+
+    // Пакетное добавление и восстановление из снимка
+    graph.addVertexes({{2, -1.0, 5}, {2, 1.0, 5}});
+    EXPECT_NO_THROW(graph.dijkstra(0));
+    graph.addVertexes({{5, -1.0, 6}});
+    EXPECT_THROW(DirectedGraph(graph.freeze()).dijkstra(0), std::logic_error);
+    graph.removeVertex(5, 6);
+    EXPECT_NO_THROW(DirectedGraph(graph.freeze()).dijkstra(0));
+}
@@ -1,5 +1,7 @@
 #include "../graph/directed_graph.h"
 #include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include <thread>
+#include <unordered_map>
 
 
 TEST(DirectedGraphTest, DefaultConstructor) 
@@ -140,3 +142,145 @@ TEST(DirectedGraphTest, UpdateEdgeWeight)
     
     EXPECT_DOUBLE_EQ(graph.removeVertex(0, 1), 2.5);
 }
+
+
+TEST(DirectedGraphTest, RemoveNodeWithNeighbours) 
+{
+    DirectedGraph graph(5);
+    for (size_t i = 0; i < 5; ++i)
+    {
+        graph.insertNode(i);
+    }
+    graph.addVertex(0, 1.0, 2);
+    graph.addVertex(2, 1.0, 1);
+    graph.addVertex(3, 1.0, 2); // Входящее ребро от узла с большим номером
+    graph.addVertex(4, 1.0, 2);
+    graph.addVertex(2, 1.0, 2); // Петля
+    graph.addVertex(3, 1.0, 4);
+
+    graph.removeNode(2);
+
+    EXPECT_FALSE(graph.searchNode(2));
+    EXPECT_EQ(graph.size(), 4);
+    EXPECT_TRUE(graph.hasVertex(3, 4));
+    EXPECT_THROW(graph.hasVertex(3, 2), std::invalid_argument);
+
+    // Узел можно вставить заново без старых рёбер
+    graph.insertNode(2);
+    EXPECT_FALSE(graph.hasVertex(0, 2));
+    EXPECT_FALSE(graph.hasVertex(2, 1));
+    EXPECT_FALSE(graph.hasVertex(4, 2));
+    graph.addVertex(2, 1.0, 0); // Обратное ребро снова допустимо
+    EXPECT_THROW(graph.wave(3, 0), std::logic_error); // Пути нет: 3 -> 4 и больше никуда
+}
+
+// Источник памяти, считающий выделенные байты
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    size_t allocated = 0; // Выделено и ещё не освобождено
+    size_t calls = 0; // Количество выделений
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        allocated += bytes;
+        calls++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override
+    {
+        allocated -= bytes;
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+TEST(DirectedGraphTest, MemoryResource)
+{
+    CountingResource resource;
+    {
+        DirectedGraph graph(100, &resource);
+        for (size_t i = 0; i < 100; ++i)
+        {
+            graph.insertNode(i);
+        }
+        for (size_t i = 1; i < 100; ++i)
+        {
+            graph.addVertex(0, double(i), i); // Узел большой степени с хеш-индексом
+            graph.addVertex(i, 1.0, (i + 1) % 100 == 0 ? 1 : i + 1);
+        }
+        EXPECT_GT(resource.allocated, 0);
+        EXPECT_LT(resource.calls, 100); // Пул берёт у источника крупные блоки, а не память под каждый список
+
+        // Копия разделяет с оригиналом блоки и пул
+        DirectedGraph copy(graph);
+        DirectedGraph moved(std::move(graph));
+        EXPECT_TRUE(moved.hasVertex(0, 50));
+        EXPECT_DOUBLE_EQ(moved.dijkstra(0).at(50), 50.0);
+        EXPECT_EQ(copy.dijkstra(0), moved.dijkstra(0));
+
+        // Граф после перемещения остаётся пригодным
+        graph.insertNode(3);
+        graph.insertNode(4);
+        graph.addVertex(3, 2.0, 4);
+        EXPECT_TRUE(graph.hasVertex(3, 4));
+
+        copy = moved;
+        moved.removeNode(0);
+        EXPECT_TRUE(copy.hasVertex(0, 99));
+    }
+    EXPECT_EQ(resource.allocated, 0); // Вся память возвращена источнику
+}
+
+// Тест снимков: копия не меняется при изменении оригинала, в том числе во время чтения в другом потоке
+TEST(DirectedGraphTest, CopyOnWriteSnapshot)
+{
+    DirectedGraph graph(300);
+    for (size_t i = 0; i < 300; ++i)
+    {
+        graph.insertNode(i);
+    }
+    for (size_t i = 0; i + 1 < 300; ++i)
+    {
+        graph.addVertex(i, 1.0, i + 1);
+    }
+
+    DirectedGraph snapshot(graph);
+    std::unordered_map<size_t, double> expected = snapshot.dijkstra(0);
+    std::thread reader([&]()
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            EXPECT_EQ(snapshot.dijkstra(0), expected);
+        }
+    });
+    for (size_t i = 0; i + 2 < 300; i += 2)
+    {
+        graph.addVertex(i, 0.5, i + 2);
+    }
+    graph.removeNode(150);
+    graph.insertNode(400);
+    graph.addVertex(0, 1.0, 400);
+    reader.join();
+
+    EXPECT_FALSE(snapshot.hasVertex(0, 2));
+    EXPECT_TRUE(snapshot.searchNode(150));
+    EXPECT_FALSE(snapshot.searchNode(400));
+    EXPECT_EQ(snapshot.size(), 300);
+    EXPECT_DOUBLE_EQ(snapshot.dijkstra(0).at(299), 299.0);
+
+    EXPECT_TRUE(graph.hasVertex(0, 2));
+    EXPECT_FALSE(graph.searchNode(150));
+    EXPECT_TRUE(graph.hasVertex(0, 400));
+    EXPECT_DOUBLE_EQ(graph.dijkstra(0).at(148), 37.0);
+
+    // Изменение снимка не затрагивает оригинал
+    snapshot.removeVertex(0, 1);
+    EXPECT_TRUE(graph.hasVertex(0, 1));
+}
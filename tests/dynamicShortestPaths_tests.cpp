@@ -0,0 +1,137 @@
+#include "../graph/dynamic_shortest_paths.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include "testGraphs.h"
+#include <random>
+#include <limits>
+
+// Вспомогательная функция: сравнение поддерживаемых расстояний с полным пересчётом
+static void expectMatchesRecomputation(const DirectedGraph& graph, const DynamicShortestPaths& dynamic)
+{
+    ShortestPaths expected = graph.dijkstraPaths(dynamic.paths().origin());
+    for (size_t key = 0; key < expected.capacity(); ++key)
+    {
+        ASSERT_EQ(dynamic.paths().contains(key), expected.contains(key)) << key;
+        if (!expected.contains(key)) continue;
+        if (!expected.isReachable(key)) EXPECT_EQ(dynamic.distance(key), expected.distance(key)) << key;
+        else EXPECT_NEAR(dynamic.distance(key), expected.distance(key), 1e-9) << key;
+
+        // Дерево предков должно давать тот же путь по длине
+        if (expected.isReachable(key) && key != expected.origin())
+        {
+            size_t predecessor = dynamic.paths().predecessor(key);
+            ASSERT_TRUE(graph.hasVertex(predecessor, key));
+        }
+    }
+}
+
+// Тест: вставка ребра и уменьшение веса
+TEST(DynamicShortestPathsTest, DecreaseUpdates)
+{
+    DirectedGraph graph;
+    for (size_t i = 0; i < 4; ++i)
+        graph.insertNode(i);
+    graph.addVertex(0, 5.0, 1);
+    graph.addVertex(1, 1.0, 2);
+
+    DynamicShortestPaths dynamic(graph, 0);
+    EXPECT_DOUBLE_EQ(dynamic.distance(2), 6.0);
+    EXPECT_EQ(dynamic.distance(3), std::numeric_limits<double>::infinity());
+
+    dynamic.addVertex(2, 1.0, 3);
+    EXPECT_DOUBLE_EQ(dynamic.distance(3), 7.0);
+
+    dynamic.addVertex(0, 2.0, 1); // Уменьшение веса ребра дерева
+    EXPECT_DOUBLE_EQ(dynamic.distance(3), 4.0);
+    EXPECT_EQ(dynamic.updatedNodes(), 3);
+    EXPECT_EQ(dynamic.paths().reconstructPath(3), (std::vector<size_t>{0, 1, 2, 3}));
+}
+
+// Тест: увеличение веса и удаление ребра с переходом на обходной путь
+TEST(DynamicShortestPathsTest, IncreaseAndDeletion)
+{
+    DirectedGraph graph;
+    for (size_t i = 0; i < 5; ++i)
+        graph.insertNode(i);
+    graph.addVertex(0, 1.0, 1);
+    graph.addVertex(1, 1.0, 2);
+    graph.addVertex(2, 1.0, 3);
+    graph.addVertex(0, 5.0, 2);
+    graph.addVertex(4, 1.0, 0);
+
+    DynamicShortestPaths dynamic(graph, 0);
+    EXPECT_DOUBLE_EQ(dynamic.distance(3), 3.0);
+
+    dynamic.addVertex(1, 10.0, 2); // Подорожало ребро дерева
+    EXPECT_DOUBLE_EQ(dynamic.distance(2), 5.0);
+    EXPECT_DOUBLE_EQ(dynamic.distance(3), 6.0);
+    EXPECT_EQ(dynamic.paths().predecessor(2), 0);
+
+    dynamic.addVertex(1, 20.0, 4); // Узел 4 становится достижимым
+    EXPECT_DOUBLE_EQ(dynamic.distance(4), 21.0);
+    dynamic.addVertex(0, 1.0, 3); // Ребро вне дерева: путь до 4 не меняется
+    EXPECT_DOUBLE_EQ(dynamic.distance(4), 21.0);
+    EXPECT_DOUBLE_EQ(dynamic.distance(3), 1.0);
+
+    EXPECT_DOUBLE_EQ(dynamic.removeVertex(0, 2), 5.0);
+    EXPECT_DOUBLE_EQ(dynamic.distance(2), 11.0);
+
+    dynamic.removeNode(1);
+    EXPECT_EQ(dynamic.distance(2), std::numeric_limits<double>::infinity());
+    EXPECT_EQ(dynamic.distance(4), std::numeric_limits<double>::infinity());
+    EXPECT_DOUBLE_EQ(dynamic.distance(3), 1.0);
+    EXPECT_FALSE(dynamic.paths().contains(1));
+    expectMatchesRecomputation(graph, dynamic);
+}
+
+// Тест ошибок
+TEST(DynamicShortestPathsTest, Errors)
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+    graph.addVertex(0, 1.0, 1);
+
+    DynamicShortestPaths dynamic(graph, 0);
+    EXPECT_THROW(dynamic.addVertex(0, -1.0, 1), std::invalid_argument);
+    EXPECT_THROW(dynamic.addVertex(1, 1.0, 0), std::logic_error);
+    EXPECT_THROW(dynamic.removeVertex(1, 0), std::logic_error);
+    EXPECT_THROW(dynamic.removeNode(0), std::invalid_argument);
+    EXPECT_THROW(dynamic.removeNode(5), std::invalid_argument);
+    EXPECT_DOUBLE_EQ(dynamic.distance(1), 1.0);
+
+    graph.addVertex(1, -1.0, 1); // Петля с отрицательным весом в обход объекта
+    EXPECT_THROW(DynamicShortestPaths(graph, 0), std::logic_error);
+}
+
+// Тест: случайная последовательность изменений совпадает с полным пересчётом
+TEST(DynamicShortestPathsTest, RandomUpdatesMatchRecomputation)
+{
+    DirectedGraph graph = makeRandomGraph(150, 600, 21);
+    DynamicShortestPaths dynamic(graph, 0);
+
+    std::mt19937 generator(8);
+    std::uniform_int_distribution<size_t> node(0, 159);
+    std::uniform_real_distribution<double> weight(0.5, 10.0);
+    std::uniform_int_distribution<int> action(0, 9);
+
+    for (size_t step = 0; step < 1500; ++step)
+    {
+        size_t origin = node(generator);
+        size_t destination = node(generator);
+        int kind = action(generator);
+        try
+        {
+            if (kind == 0 && origin != 0) dynamic.removeNode(origin);
+            else if (kind == 1 && !graph.searchNode(origin)) dynamic.insertNode(origin);
+            else if (kind < 5) dynamic.removeVertex(origin, destination);
+            else dynamic.addVertex(origin, weight(generator), destination);
+        }
+        catch (const std::exception&)
+        {
+            continue; // Недопустимое изменение не должно менять пути
+        }
+
+        if (step % 50 == 0) expectMatchesRecomputation(graph, dynamic);
+    }
+    expectMatchesRecomputation(graph, dynamic);
+}
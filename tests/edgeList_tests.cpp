@@ -0,0 +1,89 @@
+#include "../graph/directed_graph.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include <random>
+#include <map>
+
+// Ребро для проверки списка отдельно от графа
+struct TestEdge
+{
+    double weight_;
+    size_t destination_;
+};
+
+// Тест поиска, добавления и удаления рёбер в списке малой степени
+TEST(EdgeListTest, SmallDegree)
+{
+    EdgeList<TestEdge> edges;
+    edges.insert({1.0, 3});
+    edges.insert({2.0, 5});
+
+    ASSERT_NE(edges.find(5), nullptr);
+    EXPECT_DOUBLE_EQ(edges.find(5)->weight_, 2.0);
+    EXPECT_EQ(edges.find(4), nullptr);
+
+    EXPECT_TRUE(edges.erase(3));
+    EXPECT_FALSE(edges.erase(3));
+    EXPECT_EQ(edges.size(), 1);
+    EXPECT_DOUBLE_EQ(edges.find(5)->weight_, 2.0);
+}
+
+// Тест совпадения со словарём при случайных операциях выше порога построения индекса
+TEST(EdgeListTest, MatchesReferenceWithIndex)
+{
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<size_t> node(0, 300);
+    std::uniform_int_distribution<int> action(0, 2);
+
+    EdgeList<TestEdge> edges;
+    std::map<size_t, double> expected;
+    for (size_t step = 0; step < 20000; ++step)
+    {
+        size_t destination = node(generator);
+        if (action(generator) != 0)
+        {
+            if (edges.find(destination) == nullptr) edges.insert({double(step), destination});
+            else edges.find(destination)->weight_ = double(step);
+            expected[destination] = double(step);
+        }
+        else
+        {
+            EXPECT_EQ(edges.erase(destination), expected.erase(destination) == 1);
+        }
+
+        if (step % 1000 == 0)
+        {
+            ASSERT_EQ(edges.size(), expected.size());
+            for (size_t key = 0; key <= 300; ++key)
+            {
+                auto found = expected.find(key);
+                if (found == expected.end()) EXPECT_EQ(edges.find(key), nullptr);
+                else
+                {
+                    ASSERT_NE(edges.find(key), nullptr);
+                    EXPECT_DOUBLE_EQ(edges.find(key)->weight_, found->second);
+                }
+            }
+        }
+    }
+}
+
+// Тест операций над рёбрами узла большой степени в графе
+TEST(EdgeListTest, HubNode)
+{
+    DirectedGraph graph(1000);
+    for (size_t i = 0; i < 1000; ++i)
+        graph.insertNode(i);
+    for (size_t i = 1; i < 1000; ++i)
+        graph.addVertex(0, double(i), i);
+
+    EXPECT_TRUE(graph.hasVertex(0, 500));
+    EXPECT_THROW(graph.addVertex(500, 1.0, 0), std::logic_error);
+    graph.addVertex(0, 1.0, 500);
+    EXPECT_DOUBLE_EQ(graph.removeVertex(0, 500), 1.0);
+    EXPECT_FALSE(graph.hasVertex(0, 500));
+
+    for (size_t i = 2; i < 1000; i += 2)
+        graph.removeNode(i);
+    EXPECT_EQ(graph.dijkstra(0).size(), 500);
+    EXPECT_DOUBLE_EQ(graph.dijkstra(0).at(999), 999.0);
+}
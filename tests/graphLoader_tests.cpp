@@ -0,0 +1,254 @@
+#include "../graph/graph_io.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <streambuf>
+#include <cstdio>
+
+// Вспомогательная функция: текст случайных рёбер (с повторами, обратными рёбрами и ошибочными строками)
+static std::string makeEdgeText(size_t nodes, size_t lines, unsigned seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<size_t> node(0, nodes - 1);
+    std::uniform_int_distribution<int> weight(1, 100);
+    std::uniform_int_distribution<int> broken(0, 50);
+
+    std::ostringstream text;
+    for (size_t i = 0; i < lines; ++i)
+    {
+        if (broken(generator) == 0) text << "(" << node(generator) << "; 1, 2)\n";
+        else text << "(" << node(generator) << ", " << weight(generator) << ".5, " << node(generator) << ")\n";
+    }
+    return text.str();
+}
+
+// Вспомогательная функция: проверка совпадения рёбер двух графов
+static void expectSameGraphs(const DirectedGraph& expected, const DirectedGraph& actual, size_t nodes)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t origin = 0; origin < nodes; ++origin)
+    {
+        ASSERT_EQ(expected.searchNode(origin), actual.searchNode(origin));
+        if (!expected.searchNode(origin)) continue;
+
+        for (size_t destination = 0; destination < nodes; ++destination)
+        {
+            if (!expected.searchNode(destination)) continue;
+            EXPECT_EQ(expected.hasVertex(origin, destination), actual.hasVertex(origin, destination));
+        }
+    }
+}
+
+// Тест разбора одной строки
+TEST(GraphLoaderTest, ParseVertex)
+{
+    DirectedGraph::VertexRecord record;
+    std::string line = "  ( 3 ,\t-2.5e1, +7 ) tail";
+    ASSERT_TRUE(parseVertex(line.data(), line.data() + line.size(), record));
+    EXPECT_EQ(record.origin, 3);
+    EXPECT_DOUBLE_EQ(record.weight, -25.0);
+    EXPECT_EQ(record.destination, 7);
+
+    for (std::string bad : {"", "(1, 2, 3", "(1, 2; 3)", "1, 2, 3)", "(a, 2, 3)", "(1.5, 2, 3)"})
+    {
+        EXPECT_FALSE(parseVertex(bad.data(), bad.data() + bad.size(), record)) << bad;
+    }
+}
+
+// Тест: параллельный разбор совпадает с последовательным
+TEST(GraphLoaderTest, ParallelParseMatchesSequential)
+{
+    std::string text = makeEdgeText(1000, 200000, 5); // Несколько мегабайт — текст делится на части
+    text += "(1, 1.0, 2)"; // Последняя строка без перевода строки
+
+    std::vector<DirectedGraph::VertexRecord> expected;
+    LoadStats expectedStats;
+    parseVertexes(text.data(), text.size(), expected, expectedStats, 1);
+    EXPECT_EQ(expectedStats.lines, 200001);
+    EXPECT_EQ(expectedStats.vertexes + expectedStats.malformed, expectedStats.lines);
+
+    std::vector<DirectedGraph::VertexRecord> actual;
+    LoadStats actualStats;
+    parseVertexes(text.data(), text.size(), actual, actualStats, 4);
+
+    EXPECT_EQ(actualStats.lines, expectedStats.lines);
+    EXPECT_EQ(actualStats.malformed, expectedStats.malformed);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        EXPECT_EQ(actual[i].origin, expected[i].origin);
+        EXPECT_EQ(actual[i].weight, expected[i].weight);
+        EXPECT_EQ(actual[i].destination, expected[i].destination);
+    }
+}
+
+// Тест: загрузка файла даёт тот же граф, что и построчное чтение из потока
+TEST(GraphLoaderTest, LoadMatchesStreamReading)
+{
+    std::string text = makeEdgeText(300, 5000, 9);
+    std::string fileName = "graph_loader_test.txt";
+    std::ofstream(fileName) << text;
+
+    DirectedGraph expected;
+    std::istringstream input(text);
+    std::string line;
+    while (std::getline(input, line))
+    {
+        std::istringstream iss(line);
+        vertexIO temp;
+        if (!(iss >> temp)) continue;
+        if (!expected.searchNode(temp.origin)) expected.insertNode(temp.origin);
+        if (!expected.searchNode(temp.destination)) expected.insertNode(temp.destination);
+        if (!expected.hasVertex(temp.destination, temp.origin)) expected.addVertex(temp.origin, temp.weight, temp.destination);
+    }
+
+    DirectedGraph actual;
+    LoadStats stats = loadGraph(fileName, actual, 2);
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(stats.lines, 5000);
+    EXPECT_GT(stats.skipped, 0);
+    expectSameGraphs(expected, actual, 300);
+    for (size_t origin : {0, 17, 150})
+    {
+        if (expected.searchNode(origin))
+        {
+            EXPECT_EQ(actual.dijkstra(origin), expected.dijkstra(origin));
+        }
+    }
+}
+
+// Тест: отсутствующий файл
+TEST(GraphLoaderTest, MissingFile)
+{
+    DirectedGraph graph;
+    EXPECT_THROW(loadGraph("no_such_file.txt", graph), std::runtime_error);
+}
+
+// Тест пакетного добавления рёбер в непустой граф
+TEST(GraphLoaderTest, AddVertexesToExistingGraph)
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+    graph.addVertex(0, 1.0, 1);
+
+    size_t skipped = graph.addVertexes({{1, 5.0, 0}, {0, 2.0, 1}, {1, 3.0, 12}, {12, 1.0, 0}});
+    EXPECT_EQ(skipped, 1); // Ребро 1 -> 0 обратно существующему 0 -> 1
+    EXPECT_EQ(graph.size(), 3);
+    EXPECT_DOUBLE_EQ(graph.dijkstra(0).at(1), 2.0);
+    EXPECT_DOUBLE_EQ(graph.dijkstra(0).at(12), 5.0);
+}
+
+// Тест: потоковая загрузка маленьким буфером даёт тот же граф, что и загрузка файла
+TEST(GraphLoaderTest, StreamMatchesBulkLoad)
+{
+    std::string text = makeEdgeText(200, 3000, 13);
+    text += "(3, 1.0, 4)"; // Последняя строка без перевода строки
+    std::string fileName = "graph_loader_stream.txt";
+    std::ofstream(fileName) << text;
+
+    DirectedGraph expected;
+    LoadStats expectedStats = loadGraph(fileName, expected, 1);
+    std::remove(fileName.c_str());
+
+    DirectedGraph actual;
+    StreamLoader loader(actual, 256);
+    std::istringstream input(text);
+    size_t batches = 0;
+    size_t lines = 0;
+    LoadStats stats = loader.ingest(input, [&](const BatchStats& batch)
+    {
+        EXPECT_EQ(batch.batch, batches);
+        EXPECT_LE(batch.errors.size(), StreamLoader::maxBatchErrors);
+        batches++;
+        lines += batch.lines;
+    });
+
+    EXPECT_GT(batches, 100);
+    EXPECT_EQ(lines, 3001);
+    EXPECT_EQ(stats.lines, expectedStats.lines);
+    EXPECT_EQ(stats.malformed, expectedStats.malformed);
+    EXPECT_EQ(stats.skipped, expectedStats.skipped);
+    expectSameGraphs(expected, actual, 200);
+}
+
+// Буфер потока, похожий на канал: отдаёт записи источника по одной и только по запросу,
+// готовых данных сверх текущей записи у него нет
+class PipeBuffer : public std::streambuf
+{
+public:
+    explicit PipeBuffer(std::vector<std::string> writes):
+        writes_(std::move(writes))
+    {}
+
+    // Количество записей, отданных читателю
+    size_t delivered() const
+    {
+        return delivered_;
+    }
+
+protected:
+    int_type underflow() override
+    {
+        if (delivered_ == writes_.size()) return traits_type::eof();
+        std::string& write = writes_[delivered_++];
+        setg(write.data(), write.data(), write.data() + write.size());
+        return traits_type::to_int_type(write[0]);
+    }
+
+private:
+    std::vector<std::string> writes_;
+    size_t delivered_ = 0;
+};
+
+// Тест: пакеты приходят по мере поступления данных, не дожидаясь заполнения буфера и конца потока
+TEST(GraphLoaderTest, StreamBatchesShortWrites)
+{
+    PipeBuffer pipe({"(0, 1.0, 1)\n", "(1, 2.0, 2)\n(2, 1.0, 3)\n", "(3, 1.0, ", "4)\n(4, 1.0, 5)"});
+    std::istream input(&pipe);
+
+    DirectedGraph graph;
+    StreamLoader loader(graph);
+    std::vector<size_t> delivered; // Отданные каналом записи к моменту каждого пакета
+    std::vector<size_t> lines;
+    LoadStats stats = loader.ingest(input, [&](const BatchStats& batch)
+    {
+        delivered.push_back(pipe.delivered());
+        lines.push_back(batch.lines);
+        if (batch.batch == 0) EXPECT_TRUE(graph.hasVertex(0, 1)); // Первое ребро уже в графе
+    });
+
+    EXPECT_EQ(delivered, (std::vector<size_t>{1, 2, 3, 4, 4}));
+    EXPECT_EQ(lines, (std::vector<size_t>{1, 2, 0, 1, 1}));
+    EXPECT_EQ(stats.lines, 5);
+    EXPECT_EQ(stats.vertexes, 5);
+    EXPECT_DOUBLE_EQ(graph.shortestPath(0, 5), 6.0);
+}
+
+// Тест сообщений об ошибках с номерами строк
+TEST(GraphLoaderTest, StreamReportsErrors)
+{
+    std::string text = "(0, 1.0, 1)\n(1, 2.0, 0)\nbroken\n(" + std::string(200, '7') + ", 1.0, 2)\n(1, 1.0, 2)\n";
+
+    DirectedGraph graph;
+    StreamLoader loader(graph, 64);
+    std::istringstream input(text);
+    std::vector<IngestError> errors;
+    LoadStats stats = loader.ingest(input, [&](const BatchStats& batch)
+    {
+        errors.insert(errors.end(), batch.errors.begin(), batch.errors.end());
+    });
+
+    EXPECT_EQ(stats.lines, 5);
+    EXPECT_EQ(stats.malformed, 2);
+    EXPECT_EQ(stats.skipped, 1);
+    ASSERT_EQ(errors.size(), 3);
+    EXPECT_EQ(errors[0].line, 2); // Обратное ребро
+    EXPECT_EQ(errors[1].line, 3); // Неверный формат
+    EXPECT_EQ(errors[2].line, 4); // Строка длиннее буфера
+    EXPECT_TRUE(graph.hasVertex(0, 1));
+    EXPECT_TRUE(graph.hasVertex(1, 2));
+    EXPECT_EQ(graph.size(), 3);
+}
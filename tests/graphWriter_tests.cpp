@@ -0,0 +1,140 @@
+#include "../graph/graph_io.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include "testGraphs.h"
+#include <sstream>
+#include <cstdio>
+
+// Вспомогательная функция: случайный граф с дробными и отрицательными весами
+static DirectedGraph makeSignedGraph(size_t nodes, size_t vertexes, unsigned seed)
+{
+    RandomGraphOptions options;
+    options.minWeight = -10.0;
+    options.maxWeight = 10.0;
+    return makeRandomGraph(nodes, vertexes, seed, options);
+}
+
+// Вспомогательная функция: проверка совпадения узлов и рёбер (включая точные веса)
+static void expectSameGraphs(const DirectedGraph& expected, const DirectedGraph& actual)
+{
+    EXPECT_EQ(expected.size(), actual.size());
+    expected.forEachNode([&](size_t key) { EXPECT_TRUE(actual.searchNode(key)); });
+
+    size_t count = 0;
+    actual.forEachVertex([&](size_t, double, size_t) { count++; });
+    expected.forEachVertex([&](size_t origin, double weight, size_t destination)
+    {
+        ASSERT_TRUE(actual.hasVertex(origin, destination));
+        DirectedGraph copy(actual);
+        EXPECT_EQ(copy.removeVertex(origin, destination), weight);
+        count--;
+    });
+    EXPECT_EQ(count, 0);
+}
+
+// Тест: текстовый формат читается обратно без потери точности весов
+TEST(GraphWriterTest, TextRoundTrip)
+{
+    DirectedGraph graph = makeSignedGraph(60, 300, 3);
+    std::string fileName = "graph_writer_text.txt";
+    ASSERT_TRUE(writeData(fileName, graph));
+
+    DirectedGraph loaded;
+    ASSERT_TRUE(readData(fileName, loaded));
+    std::remove(fileName.c_str());
+
+    expectSameGraphs(graph, loaded);
+}
+
+// Тест: двоичный снимок восстанавливается в изменяемый граф вместе с узлами без рёбер
+TEST(GraphWriterTest, BinaryRoundTrip)
+{
+    DirectedGraph graph = makeSignedGraph(60, 300, 5);
+    graph.insertNode(100);
+    graph.removeNode(7);
+
+    std::string fileName = "graph_writer_binary.bin";
+    saveGraph(fileName, graph, GraphFormat::Binary);
+    DirectedGraph restored(CompressedGraph::load(fileName, true));
+    std::remove(fileName.c_str());
+
+    expectSameGraphs(graph, restored);
+    EXPECT_TRUE(restored.searchNode(100));
+    EXPECT_FALSE(restored.searchNode(7));
+
+    // Восстановленный граф можно изменять
+    restored.addVertex(100, 1.0, 0);
+    EXPECT_THROW(restored.addVertex(0, 1.0, 100), std::logic_error);
+    restored.removeNode(0);
+    EXPECT_FALSE(restored.hasVertex(100, 1));
+}
+
+// Поток без позиционирования: байты дописываются в строку
+class AppendOnlyBuffer : public std::streambuf
+{
+public:
+    std::string data;
+
+protected:
+    int_type overflow(int_type symbol) override
+    {
+        if (symbol != traits_type::eof()) data.push_back(static_cast<char>(symbol));
+        return symbol;
+    }
+
+    std::streamsize xsputn(const char* text, std::streamsize count) override
+    {
+        data.append(text, count);
+        return count;
+    }
+};
+
+// Тест: потоковая запись снимка совпадает с записью построенного снимка (с позиционированием и без)
+TEST(GraphWriterTest, BinaryMatchesFrozenSnapshot)
+{
+    DirectedGraph graph = makeSignedGraph(150, 700, 9);
+    graph.removeNode(3);
+    graph.insertNode(200); // Вместимость растёт, узел без рёбер
+
+    std::ostringstream expected;
+    graph.freeze().save(expected);
+
+    std::ostringstream seekable;
+    writeGraph(seekable, graph, GraphFormat::Binary);
+    EXPECT_EQ(seekable.str(), expected.str());
+
+    AppendOnlyBuffer buffer;
+    std::ostream appendOnly(&buffer);
+    writeGraph(appendOnly, graph, GraphFormat::Binary);
+    EXPECT_EQ(buffer.data, expected.str());
+}
+
+// Тест форматов списка рёбер и DOT
+TEST(GraphWriterTest, EdgeListAndDot)
+{
+    DirectedGraph graph(4);
+    graph.insertNode(0);
+    graph.insertNode(1);
+    graph.insertNode(3);
+    graph.addVertex(0, 2.5, 1);
+    graph.addVertex(3, -1.0, 1);
+
+    std::ostringstream edges;
+    writeGraph(edges, graph, GraphFormat::EdgeList);
+    EXPECT_EQ(edges.str(), "0 1 2.5\n3 1 -1\n");
+
+    std::ostringstream text;
+    writeGraph(text, graph);
+    EXPECT_EQ(text.str(), "(0, 2.5, 1)\n(3, -1, 1)\n");
+
+    std::ostringstream dot;
+    writeGraph(dot, graph, GraphFormat::Dot);
+    EXPECT_EQ(dot.str(), "digraph G {\n  0;\n  1;\n  3;\n  0 -> 1 [label=\"2.5\"];\n  3 -> 1 [label=\"-1\"];\n}\n");
+}
+
+// Тест ошибки записи в недоступный файл
+TEST(GraphWriterTest, UnwritableFile)
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    EXPECT_THROW(saveGraph("no_such_directory/graph.txt", graph), std::runtime_error);
+}
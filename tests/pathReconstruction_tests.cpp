@@ -0,0 +1,91 @@
+#include "../graph/directed_graph.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include <vector>
+
+// Вспомогательная функция: граф с отрицательным ребром и несколькими путями
+static DirectedGraph makeGraph()
+{
+    DirectedGraph graph;
+    for (size_t i = 0; i < 5; ++i)
+    {
+        graph.insertNode(i);
+    }
+
+    graph.addVertex(0, 5.0, 1);
+    graph.addVertex(0, 2.0, 2);
+    graph.addVertex(2, 1.0, 1);
+    graph.addVertex(1, 3.0, 3);
+    return graph;
+}
+
+// Тест восстановления пути Дейкстры
+TEST(PathReconstructionTest, DijkstraPath)
+{
+    DirectedGraph graph = makeGraph();
+    ShortestPaths paths = graph.dijkstraPaths(0);
+
+    EXPECT_EQ(paths.reconstructPath(3), (std::vector<size_t>{0, 2, 1, 3}));
+    EXPECT_EQ(paths.reconstructPath(0), (std::vector<size_t>{0}));
+}
+
+// Тест восстановления пути Беллмана — Форда
+TEST(PathReconstructionTest, BellmanFordPath)
+{
+    DirectedGraph graph = makeGraph();
+    graph.addVertex(0, -1.0, 3);
+    ShortestPaths paths = graph.bellmanFordPaths(0);
+
+    EXPECT_EQ(paths.reconstructPath(3), (std::vector<size_t>{0, 3}));
+    EXPECT_EQ(paths.reconstructPath(1), (std::vector<size_t>{0, 2, 1}));
+}
+
+// Тест восстановления пути волнового алгоритма
+TEST(PathReconstructionTest, WavePath)
+{
+    DirectedGraph graph = makeGraph();
+    ShortestPaths paths = graph.wavePaths(0);
+
+    EXPECT_DOUBLE_EQ(paths.distance(3), 2.0);
+    EXPECT_EQ(paths.reconstructPath(3), (std::vector<size_t>{0, 1, 3}));
+    EXPECT_EQ(paths.distance(3), graph.wave(0, 3));
+    EXPECT_FALSE(paths.isReachable(4));
+}
+
+// Тест повторного использования буфера
+TEST(PathReconstructionTest, ReusesBuffer)
+{
+    DirectedGraph graph = makeGraph();
+    ShortestPaths paths = graph.dijkstraPaths(0);
+
+    std::vector<size_t> path;
+    path.reserve(8);
+    const size_t* data = path.data();
+
+    paths.reconstructPath(3, path);
+    EXPECT_EQ(path, (std::vector<size_t>{0, 2, 1, 3}));
+    paths.reconstructPath(2, path);
+    EXPECT_EQ(path, (std::vector<size_t>{0, 2}));
+    EXPECT_EQ(path.data(), data);
+}
+
+// Тест ошибок восстановления пути
+TEST(PathReconstructionTest, Errors)
+{
+    DirectedGraph graph = makeGraph();
+    ShortestPaths paths = graph.dijkstraPaths(0);
+
+    EXPECT_THROW(paths.reconstructPath(4), std::logic_error);
+    EXPECT_THROW(paths.reconstructPath(9), std::invalid_argument);
+    EXPECT_THROW(graph.wavePaths(9), std::invalid_argument);
+}
+
+// Тест совпадения путей на CSR-снимке
+TEST(PathReconstructionTest, CompressedGraphPaths)
+{
+    DirectedGraph graph = makeGraph();
+    CompressedGraph frozen = graph.freeze();
+
+    EXPECT_EQ(frozen.dijkstraPaths(0).reconstructPath(3), graph.dijkstraPaths(0).reconstructPath(3));
+    EXPECT_EQ(frozen.bellmanFordPaths(0).reconstructPath(3), graph.bellmanFordPaths(0).reconstructPath(3));
+    EXPECT_EQ(frozen.wavePaths(0).reconstructPath(3), graph.wavePaths(0).reconstructPath(3));
+}
@@ -0,0 +1,114 @@
+#include "../graph/directed_graph.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include "testGraphs.h"
+#include <limits>
+
+// Тест базового запроса для пары узлов
+TEST(PointToPointTest, BasicShortestPath)
+{
+    DirectedGraph graph;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        graph.insertNode(i);
+    }
+    graph.addVertex(0, 5.0, 1);
+    graph.addVertex(0, 2.0, 2);
+    graph.addVertex(2, 1.0, 1);
+    graph.addVertex(1, 3.0, 3);
+
+    EXPECT_DOUBLE_EQ(graph.shortestPath(0, 3), 6.0);
+    EXPECT_DOUBLE_EQ(graph.bidirectionalShortestPath(0, 3), 6.0);
+    EXPECT_DOUBLE_EQ(graph.shortestPath(0, 0), 0.0);
+    EXPECT_DOUBLE_EQ(graph.bidirectionalShortestPath(0, 0), 0.0);
+}
+
+// Тест недостижимого узла назначения
+TEST(PointToPointTest, UnreachableDestination)
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+    graph.insertNode(2);
+    graph.addVertex(1, 1.0, 0);
+
+    EXPECT_EQ(graph.shortestPath(0, 1), std::numeric_limits<double>::infinity());
+    EXPECT_EQ(graph.bidirectionalShortestPath(0, 2), std::numeric_limits<double>::infinity());
+}
+
+// Тест ошибок
+TEST(PointToPointTest, Errors)
+{
+    DirectedGraph graph;
+    graph.insertNode(0);
+    graph.insertNode(1);
+
+    EXPECT_THROW(graph.shortestPath(0, 5), std::invalid_argument);
+    EXPECT_THROW(graph.bidirectionalShortestPath(5, 0), std::invalid_argument);
+
+    graph.addVertex(0, -1.0, 1);
+    EXPECT_THROW(graph.shortestPath(0, 1), std::logic_error);
+    EXPECT_THROW(graph.bidirectionalShortestPath(0, 1), std::logic_error);
+}
+
+// Тест обратного индекса после изменений графа
+TEST(PointToPointTest, ReverseIndexFollowsMutations)
+{
+    DirectedGraph graph;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        graph.insertNode(i);
+    }
+    graph.addVertex(0, 1.0, 1);
+    graph.addVertex(1, 1.0, 3);
+    graph.addVertex(0, 5.0, 2);
+    graph.addVertex(2, 1.0, 3);
+    EXPECT_DOUBLE_EQ(graph.bidirectionalShortestPath(0, 3), 2.0);
+
+    graph.addVertex(1, 10.0, 3); // Обновление веса
+    EXPECT_DOUBLE_EQ(graph.bidirectionalShortestPath(0, 3), 6.0);
+
+    graph.removeVertex(2, 3);
+    EXPECT_DOUBLE_EQ(graph.bidirectionalShortestPath(0, 3), 11.0);
+
+    DirectedGraph copy(graph);
+    graph.removeNode(3);
+    EXPECT_DOUBLE_EQ(copy.bidirectionalShortestPath(0, 3), 11.0);
+}
+
+// Тест совпадения с полным алгоритмом Дейкстры на случайных графах
+TEST(PointToPointTest, MatchesDijkstraOnRandomGraphs)
+{
+    for (unsigned seed = 1; seed <= 5; ++seed)
+    {
+        DirectedGraph graph = makeRandomGraph(60, 240, seed);
+        for (size_t origin = 0; origin < 60; origin += 7)
+        {
+            ShortestPaths expected = graph.dijkstraPaths(origin);
+            for (size_t destination = 0; destination < 60; ++destination)
+            {
+                EXPECT_DOUBLE_EQ(graph.shortestPath(origin, destination), expected.distance(destination));
+                EXPECT_DOUBLE_EQ(graph.bidirectionalShortestPath(origin, destination), expected.distance(destination));
+            }
+        }
+    }
+}
+
+// Тест: состояние поиска, переиспользуемое между запросами, не переносит расстояния между графами разного размера
+TEST(PointToPointTest, AlternatingGraphs)
+{
+    DirectedGraph small = makeRandomGraph(20, 60, 7);
+    DirectedGraph large = makeRandomGraph(200, 800, 8);
+    ShortestPaths smallExpected = small.dijkstraPaths(0);
+    ShortestPaths largeExpected = large.dijkstraPaths(0);
+
+    for (size_t round = 0; round < 3; ++round)
+    {
+        for (size_t destination = 0; destination < 20; ++destination)
+        {
+            EXPECT_DOUBLE_EQ(large.shortestPath(0, destination * 10), largeExpected.distance(destination * 10));
+            EXPECT_DOUBLE_EQ(small.shortestPath(0, destination), smallExpected.distance(destination));
+            EXPECT_DOUBLE_EQ(small.bidirectionalShortestPath(0, destination), smallExpected.distance(destination));
+            EXPECT_DOUBLE_EQ(large.bidirectionalShortestPath(0, destination * 10), largeExpected.distance(destination * 10));
+        }
+    }
+}
@@ -0,0 +1,82 @@
+#include "../graph/directed_graph.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include "testGraphs.h"
+#include <random>
+#include <algorithm>
+
+template <class Queue>
+class PriorityQueueTest : public ::testing::Test {};
+
+using QueueTypes = ::testing::Types<BinaryHeapQueue, QuaternaryHeapQueue, DaryHeapQueue<2>, RadixHeapQueue, PairingHeapQueue>;
+TYPED_TEST_SUITE(PriorityQueueTest, QueueTypes);
+
+// Тест извлечения в порядке возрастания приоритетов
+TYPED_TEST(PriorityQueueTest, PopsInOrder)
+{
+    TypeParam queue;
+    queue.reset(100);
+
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> priority(0.0, 1000.0);
+    std::vector<double> expected;
+    for (size_t node = 0; node < 100; ++node)
+    {
+        expected.push_back(priority(generator));
+        queue.push(expected.back(), node);
+    }
+    std::sort(expected.begin(), expected.end());
+
+    for (double value : expected)
+    {
+        ASSERT_FALSE(queue.empty());
+        EXPECT_DOUBLE_EQ(queue.pop().first, value);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+// Тест уменьшения приоритета
+TYPED_TEST(PriorityQueueTest, DecreasePriority)
+{
+    TypeParam queue;
+    queue.reset(4);
+    queue.push(10.0, 0);
+    queue.push(20.0, 1);
+    queue.push(30.0, 2);
+    queue.push(5.0, 2);
+
+    auto first = queue.pop();
+    EXPECT_EQ(first.second, 2);
+    EXPECT_DOUBLE_EQ(first.first, 5.0);
+    EXPECT_EQ(queue.pop().second, 0);
+    EXPECT_EQ(queue.pop().second, 1);
+}
+
+// Тест повторного использования очереди
+TYPED_TEST(PriorityQueueTest, Reset)
+{
+    TypeParam queue;
+    queue.reset(3);
+    queue.push(1.0, 0);
+    queue.push(2.0, 1);
+    queue.reset(3);
+
+    EXPECT_TRUE(queue.empty());
+    queue.push(3.0, 2);
+    EXPECT_EQ(queue.pop().second, 2);
+}
+
+// Тест совпадения результатов Дейкстры с очередью по умолчанию
+TYPED_TEST(PriorityQueueTest, DijkstraMatchesDefault)
+{
+    for (unsigned seed = 1; seed <= 3; ++seed)
+    {
+        DirectedGraph graph = makeRandomGraph(200, 1000, seed);
+        ShortestPaths expected = graph.dijkstraPaths(0);
+        ShortestPaths actual = graph.template dijkstraPaths<TypeParam>(0);
+
+        for (size_t key = 0; key < 200; ++key)
+        {
+            EXPECT_EQ(actual.distance(key), expected.distance(key));
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#include "../graph/query_cache.h"
+#include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+
+// Вспомогательная функция: цепочка 0 -> 1 -> ... -> nodes - 1
+static DirectedGraph makeChain(size_t nodes)
+{
+    DirectedGraph graph(nodes);
+    for (size_t i = 0; i < nodes; ++i)
+    {
+        graph.insertNode(i);
+    }
+    for (size_t i = 0; i + 1 < nodes; ++i)
+    {
+        graph.addVertex(i, 1.0, i + 1);
+    }
+    return graph;
+}
+
+// Тест версии графа
+TEST(QueryCacheTest, GraphVersion)
+{
+    DirectedGraph graph = makeChain(3);
+    size_t version = graph.version();
+
+    DirectedGraph copy(graph);
+    EXPECT_EQ(copy.version(), version); // Копия с тем же содержимым
+
+    graph.addVertex(0, 2.0, 1);
+    EXPECT_NE(graph.version(), version);
+    EXPECT_EQ(copy.version(), version);
+
+    // Неудачное изменение не меняет версию
+    version = graph.version();
+    EXPECT_THROW(graph.addVertex(1, 1.0, 0), std::logic_error);
+    EXPECT_THROW(graph.removeNode(7), std::invalid_argument);
+    EXPECT_EQ(graph.version(), version);
+
+    graph.removeVertex(0, 1);
+    EXPECT_NE(graph.version(), version);
+    EXPECT_NE(DirectedGraph().version(), DirectedGraph().version());
+}
+
+// Тест попаданий и промахов
+TEST(QueryCacheTest, HitsAndMisses)
+{
+    DirectedGraph graph = makeChain(5);
+    QueryCache cache(4);
+
+    auto first = cache.paths(graph, QueryAlgorithm::Dijkstra, 0);
+    auto second = cache.paths(graph, QueryAlgorithm::Dijkstra, 0);
+    EXPECT_EQ(first, second);
+    EXPECT_DOUBLE_EQ(second->distance(4), 4.0);
+
+    cache.paths(graph, QueryAlgorithm::Wave, 0); // Другой алгоритм — другой ключ
+    EXPECT_EQ(cache.stats().hits, 1);
+    EXPECT_EQ(cache.stats().misses, 2);
+    EXPECT_DOUBLE_EQ(cache.stats().hitRate(), 1.0 / 3);
+
+    // После изменения графа результат вычисляется заново
+    graph.addVertex(0, 1.0, 4);
+    auto updated = cache.paths(graph, QueryAlgorithm::Dijkstra, 0);
+    EXPECT_NE(updated, first);
+    EXPECT_DOUBLE_EQ(updated->distance(4), 1.0);
+    EXPECT_DOUBLE_EQ(first->distance(4), 4.0); // Выданный ранее результат не меняется
+    EXPECT_EQ(cache.stats().misses, 3);
+}
+
+// Тест вытеснения давно не использованных результатов
+TEST(QueryCacheTest, LeastRecentlyUsedEviction)
+{
+    DirectedGraph graph = makeChain(5);
+    QueryCache cache(2);
+
+    cache.paths(graph, QueryAlgorithm::Dijkstra, 0);
+    cache.paths(graph, QueryAlgorithm::Dijkstra, 1);
+    cache.paths(graph, QueryAlgorithm::Dijkstra, 0); // Узел 0 становится недавним
+    cache.paths(graph, QueryAlgorithm::Dijkstra, 2); // Вытесняет узел 1
+
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.stats().evictions, 1);
+
+    cache.paths(graph, QueryAlgorithm::Dijkstra, 0);
+    EXPECT_EQ(cache.stats().hits, 2);
+    cache.paths(graph, QueryAlgorithm::Dijkstra, 1);
+    EXPECT_EQ(cache.stats().misses, 4);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_THROW(QueryCache(0), std::invalid_argument);
+}
+
+// Тест: ошибки алгоритма не кэшируются
+TEST(QueryCacheTest, ErrorsAreNotCached)
+{
+    DirectedGraph graph = makeChain(3);
+    graph.addVertex(1, -1.0, 2);
+    QueryCache cache;
+
+    EXPECT_THROW(cache.paths(graph, QueryAlgorithm::Dijkstra, 0), std::logic_error);
+    EXPECT_THROW(cache.paths(graph, QueryAlgorithm::Dijkstra, 9), std::invalid_argument);
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_DOUBLE_EQ(cache.paths(graph, QueryAlgorithm::BellmanFord, 0)->distance(2), 0.0);
+}
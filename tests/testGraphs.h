@@ -0,0 +1,76 @@
+#ifndef TESTGRAPHS_H
+#define TESTGRAPHS_H
+
+#include "../graph/directed_graph.h"
+#include <random>
+#include <vector>
+
+// Общие генераторы графов для тестов
+
+// Параметры случайного графа
+struct RandomGraphOptions
+{
+    double minWeight = 0.5; // Наименьший вес ребра
+    double maxWeight = 10.0; // Наибольший вес ребра
+    size_t gapPeriod = 0; // Если не 0, узлы с номерами i % gapPeriod == gapPeriod / 2 не добавляются
+    // Если не 0, к весу добавляется разность случайных потенциалов узлов из [0, maxPotential]:
+    // часть рёбер становится отрицательной, а вес любого цикла остаётся положительным
+    double maxPotential = 0.0;
+};
+
+// Случайный граф без петель и встречных рёбер (такие пары пропускаются)
+inline DirectedGraph makeRandomGraph(size_t nodes, size_t vertexes, unsigned seed, const RandomGraphOptions& options = {})
+{
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<size_t> node(0, nodes - 1);
+    std::uniform_real_distribution<double> weight(options.minWeight, options.maxWeight);
+
+    std::vector<double> potentials(nodes, 0.0);
+    if (options.maxPotential > 0.0)
+    {
+        std::uniform_real_distribution<double> potential(0.0, options.maxPotential);
+        for (double& value : potentials)
+        {
+            value = potential(generator);
+        }
+    }
+
+    DirectedGraph graph(nodes);
+    for (size_t i = 0; i < nodes; ++i)
+    {
+        if (options.gapPeriod == 0 || i % options.gapPeriod != options.gapPeriod / 2) graph.insertNode(i);
+    }
+    for (size_t i = 0; i < vertexes; ++i)
+    {
+        size_t origin = node(generator);
+        size_t destination = node(generator);
+        if (!graph.searchNode(origin) || !graph.searchNode(destination)) continue;
+        if (origin == destination || graph.hasVertex(destination, origin)) continue;
+        graph.addVertex(origin, weight(generator) + potentials[origin] - potentials[destination], destination);
+    }
+    return graph;
+}
+
+// Решётка side x side с рёбрами вправо и вниз (похожа на дорожную сеть)
+inline DirectedGraph makeGridGraph(size_t side, unsigned seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> weight(1.0, 2.0);
+
+    DirectedGraph graph(side * side);
+    for (size_t i = 0; i < side * side; ++i)
+    {
+        graph.insertNode(i);
+    }
+    for (size_t row = 0; row < side; ++row)
+    {
+        for (size_t column = 0; column < side; ++column)
+        {
+            size_t node = row * side + column;
+            if (column + 1 < side) graph.addVertex(node, weight(generator), node + 1);
+            if (row + 1 < side) graph.addVertex(node, weight(generator), node + side);
+        }
+    }
+    return graph;
+}
+#endif
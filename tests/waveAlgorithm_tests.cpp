@@ -1,6 +1,8 @@
 #include "../graph/directed_graph.h"
 #include "../build/_deps/googletest-src/googletest/include/gtest/gtest.h"
+#include "../graph/thread_pool.h"
 #include <limits>
+#include <random>
 
 // Тест: базовый граф, волновой алгоритм
 TEST(WaveTest, BasicWaveShortestPath) 
@@ -97,3 +99,65 @@ TEST(WaveTest, InvalidNodes)
     EXPECT_THROW(graph.wave(1, 0), std::invalid_argument);
     EXPECT_THROW(graph.wave(5, 5), std::invalid_argument);
 }
+
+
+// Тест числа рёбер до всех узлов
+TEST(WaveTest, WaveAllHopCounts) 
+{
+    DirectedGraph graph(6);
+    for (size_t i = 0; i < 5; ++i)
+        graph.insertNode(i);
+
+    graph.addVertex(0, 1.0, 1);
+    graph.addVertex(1, 1.0, 2);
+    graph.addVertex(0, 1.0, 3);
+    graph.addVertex(3, 1.0, 2);
+
+    std::vector<size_t> hops = graph.waveAll(0, 2);
+
+    EXPECT_EQ(hops[0], 0);
+    EXPECT_EQ(hops[1], 1);
+    EXPECT_EQ(hops[2], 2);
+    EXPECT_EQ(hops[4], DirectedGraph::unreachable); // Узел 4 не соединён
+    EXPECT_EQ(hops[5], DirectedGraph::unreachable); // Узла 5 нет в графе
+    EXPECT_THROW(graph.waveAll(5), std::invalid_argument);
+}
+
+// Тест совпадения параллельного обхода с последовательным на плотных и разреженных графах
+TEST(WaveTest, WaveAllMatchesSequential) 
+{
+    std::mt19937 generator(3);
+    ThreadPool pool(3); // Один пул на все обходы
+    for (size_t vertexes : {300, 3000, 12000})
+    {
+        DirectedGraph graph(400);
+        for (size_t i = 0; i < 400; ++i)
+            graph.insertNode(i);
+
+        std::uniform_int_distribution<size_t> node(0, 399);
+        for (size_t i = 0; i < vertexes; ++i)
+        {
+            size_t origin = node(generator);
+            size_t destination = node(generator);
+            if (origin == destination || graph.hasVertex(destination, origin)) continue;
+            graph.addVertex(origin, 1.0, destination);
+        }
+
+        ShortestPaths expected = graph.wavePaths(0);
+        for (size_t threads : {1, 4})
+        {
+            std::vector<size_t> hops = graph.waveAll(0, threads);
+            for (size_t key = 0; key < 400; ++key)
+            {
+                if (expected.isReachable(key)) EXPECT_EQ(hops[key], expected.distance(key));
+                else EXPECT_EQ(hops[key], DirectedGraph::unreachable);
+            }
+        }
+        EXPECT_EQ(graph.waveAll(0, pool), graph.waveAll(0, 1));
+        for (size_t destination = 1; destination < 400; destination += 37)
+        {
+            if (expected.isReachable(destination)) EXPECT_EQ(graph.wave(0, destination), expected.distance(destination));
+            else EXPECT_THROW(graph.wave(0, destination), std::logic_error);
+        }
+    }
+}
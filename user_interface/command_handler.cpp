@@ -5,6 +5,7 @@
 void commandHandler(std::istream& in, std::ostream& out, DirectedGraph& graph)
 {
     std::string commandName;
+    QueryCache cache; // Результаты повторных запросов к неизменённому графу
 
     out << "Enter command: ";
     while(in >> commandName)
@@ -24,7 +25,7 @@ void commandHandler(std::istream& in, std::ostream& out, DirectedGraph& graph)
             // Проверяем аргумент
             if (isNumber(key))
             {
-                dijkstra(std::stoi(key), out, graph);
+                dijkstra(std::stoi(key), out, graph, cache);
             }
             else out << "\033[31mInvalid argument!\033[0m\n";
         }
@@ -37,7 +38,7 @@ void commandHandler(std::istream& in, std::ostream& out, DirectedGraph& graph)
             // Проверяем аргумент
             if (isNumber(key))
             {
-                bellman(std::stoi(key), out, graph);
+                bellman(std::stoi(key), out, graph, cache);
             }
             else out << "\033[31mInvalid argument!\033[0m\n";
         }
@@ -50,7 +51,76 @@ void commandHandler(std::istream& in, std::ostream& out, DirectedGraph& graph)
 
             if (isNumber(origin) && isNumber(destination))
             {
-                out << graph.wave(std::stoi(origin), std::stoi(destination)) << "\n";
+                wave(std::stoi(origin), std::stoi(destination), out, graph, cache);
+            }
+            else out << "\033[31mInvalid argument!\033[0m\n";
+        }
+        else if (commandName == "Dijkstra-path")
+        {
+            // Считываем аргументы команды
+            std::string origin;
+            std::string destination;
+            in >> origin >> destination;
+
+            if (isNumber(origin) && isNumber(destination))
+            {
+                dijkstraPath(std::stoi(origin), std::stoi(destination), out, graph, cache);
+            }
+            else out << "\033[31mInvalid argument!\033[0m\n";
+        }
+        else if (commandName == "Bellman-Ford-path")
+        {
+            // Считываем аргументы команды
+            std::string origin;
+            std::string destination;
+            in >> origin >> destination;
+
+            if (isNumber(origin) && isNumber(destination))
+            {
+                bellmanPath(std::stoi(origin), std::stoi(destination), out, graph, cache);
+            }
+            else out << "\033[31mInvalid argument!\033[0m\n";
+        }
+        else if (commandName == "Wave-path")
+        {
+            // Считываем аргументы команды
+            std::string origin;
+            std::string destination;
+            in >> origin >> destination;
+
+            if (isNumber(origin) && isNumber(destination))
+            {
+                wavePath(std::stoi(origin), std::stoi(destination), out, graph, cache);
+            }
+            else out << "\033[31mInvalid argument!\033[0m\n";
+        }
+        else if (commandName == "Cache-stats")
+        {
+            cacheStats(out, cache);
+        }
+        else if (commandName == "Save")
+        {
+            // Считываем аргументы команды
+            std::string fileName;
+            std::string formatName;
+            in >> fileName >> formatName;
+
+            GraphFormat format;
+            if (!fileName.empty() && parseFormat(formatName, format))
+            {
+                save(fileName, format, out, graph);
+            }
+            else out << "\033[31mInvalid argument!\033[0m\n";
+        }
+        else if (commandName == "Load")
+        {
+            // Считываем аргументы команды
+            std::string fileName;
+            in >> fileName;
+
+            if (!fileName.empty())
+            {
+                load(fileName, out, graph);
             }
             else out << "\033[31mInvalid argument!\033[0m\n";
         }
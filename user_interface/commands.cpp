@@ -1,5 +1,8 @@
 #include "../graph/directed_graph.h"
+#include "../graph/query_cache.h"
+#include "../graph/graph_io.h"
 #include <algorithm>
+#include <fstream>
 
 bool isNumber(std::string& line)
 {
@@ -22,13 +25,42 @@ void help(std::ostream& out)
 
     out << "4: \033[32mWave\033[0m \033[31m<origin>\033[0m \033[31m<destination>\033[0m\n";
     out << "   Finds the shortest distance between nodes using the wave algorithm\n";
+
+    out << "5: \033[32mDijkstra-path\033[0m \033[31m<origin>\033[0m \033[31m<destination>\033[0m\n";
+    out << "   Finds the shortest route between nodes using Dijkstra's algorithm\n";
+
+    out << "6: \033[32mBellman-Ford-path\033[0m \033[31m<origin>\033[0m \033[31m<destination>\033[0m\n";
+    out << "   Finds the shortest route between nodes using the Bellman-Ford algorithm\n";
+
+    out << "7: \033[32mWave-path\033[0m \033[31m<origin>\033[0m \033[31m<destination>\033[0m\n";
+    out << "   Finds the route with the fewest edges between nodes using the wave algorithm\n";
+
+    out << "8: \033[32mCache-stats\033[0m\n";
+    out << "   Displays hit and miss statistics of the query result cache\n";
+
+    out << "9: \033[32mSave\033[0m \033[31m<file>\033[0m \033[31m<format>\033[0m\n";
+    out << "   Saves the graph to a file; format is text, edges, dot or binary\n";
+
+    out << "10: \033[32mLoad\033[0m \033[31m<file>\033[0m\n";
+    out << "   Adds the edges from a text file to the graph, reporting malformed lines\n";
+}
+
+// Разбор названия формата записи графа
+bool parseFormat(const std::string& name, GraphFormat& format)
+{
+    if (name == "text") format = GraphFormat::Text;
+    else if (name == "edges") format = GraphFormat::EdgeList;
+    else if (name == "dot") format = GraphFormat::Dot;
+    else if (name == "binary") format = GraphFormat::Binary;
+    else return false;
+    return true;
 }
 
-void dijkstra(size_t origin, std::ostream& out, DirectedGraph& graph)
+void dijkstra(size_t origin, std::ostream& out, DirectedGraph& graph, QueryCache& cache)
 {
     try
     {
-        auto result = graph.dijkstra(origin);
+        auto result = cache.paths(graph, QueryAlgorithm::Dijkstra, origin)->toMap();
     
         for (auto& key: result)
         {
@@ -41,11 +73,11 @@ void dijkstra(size_t origin, std::ostream& out, DirectedGraph& graph)
     }
 }
 
-void bellman(size_t origin, std::ostream& out, DirectedGraph& graph)
+void bellman(size_t origin, std::ostream& out, DirectedGraph& graph, QueryCache& cache)
 {
     try
     {
-        auto result = graph.bellmanFord(origin);
+        auto result = cache.paths(graph, QueryAlgorithm::BellmanFord, origin)->toMap();
     
         for (auto& key: result)
         {
@@ -56,4 +88,96 @@ void bellman(size_t origin, std::ostream& out, DirectedGraph& graph)
     {
         out << e.what() << '\n';
     }
+}
+
+void wave(size_t origin, size_t destination, std::ostream& out, DirectedGraph& graph, QueryCache& cache)
+{
+    try
+    {
+        auto paths = cache.paths(graph, QueryAlgorithm::Wave, origin);
+        if (!paths->contains(destination)) throw std::invalid_argument("Destination node is not in the graph");
+        if (!paths->isReachable(destination)) throw std::logic_error("No path exists between the nodes");
+
+        out << static_cast<size_t>(paths->distance(destination)) << "\n";
+    }
+    catch(const std::exception& e)
+    {
+        out << e.what() << '\n';
+    }
+}
+
+void printPath(const ShortestPaths& paths, size_t destination, std::ostream& out)
+{
+    std::vector<size_t> path;
+    paths.reconstructPath(destination, path);
+
+    out << "path:";
+    for (size_t i = 0; i < path.size(); ++i)
+    {
+        out << (i == 0 ? " " : " -> ") << path[i];
+    }
+    out << " " << "distance: " << paths.distance(destination) << "\n";
+}
+
+void dijkstraPath(size_t origin, size_t destination, std::ostream& out, DirectedGraph& graph, QueryCache& cache)
+{
+    try
+    {
+        printPath(*cache.paths(graph, QueryAlgorithm::Dijkstra, origin), destination, out);
+    }
+    catch(const std::exception& e)
+    {
+        out << e.what() << '\n';
+    }
+}
+
+void bellmanPath(size_t origin, size_t destination, std::ostream& out, DirectedGraph& graph, QueryCache& cache)
+{
+    try
+    {
+        printPath(*cache.paths(graph, QueryAlgorithm::BellmanFord, origin), destination, out);
+    }
+    catch(const std::exception& e)
+    {
+        out << e.what() << '\n';
+    }
+}
+
+void wavePath(size_t origin, size_t destination, std::ostream& out, DirectedGraph& graph, QueryCache& cache)
+{
+    try
+    {
+        printPath(*cache.paths(graph, QueryAlgorithm::Wave, origin), destination, out);
+    }
+    catch(const std::exception& e)
+    {
+        out << e.what() << '\n';
+    }
+}
+
+void cacheStats(std::ostream& out, const QueryCache& cache)
+{
+    QueryCache::Stats stats = cache.stats();
+    out << "hits: " << stats.hits << " misses: " << stats.misses << " evictions: " << stats.evictions;
+    out << " hit rate: " << stats.hitRate() * 100 << "% stored: " << cache.size() << "/" << cache.capacity() << "\n";
+}
+
+void save(const std::string& fileName, GraphFormat format, std::ostream& out, const DirectedGraph& graph)
+{
+    if (writeData(fileName, graph, format)) out << "\033[32mGraph saved successfully!\033[0m\n";
+    else out << "\033[31mFailed to save the graph!\033[0m\n";
+}
+
+void load(const std::string& fileName, std::ostream& out, DirectedGraph& graph)
+{
+    std::ifstream file(fileName);
+    if (!file)
+    {
+        out << "\033[31mFailed to open the file!\033[0m\n";
+        return;
+    }
+
+    // Рёбра добавляются пакетами по мере чтения, ошибки строк выводит readStream
+    if (readStream(file, graph)) out << "\033[32mData read successfully!\033[0m\n";
+    else out << "\033[31mFailed to read the file!\033[0m\n";
 }
\ No newline at end of file